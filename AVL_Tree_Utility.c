@@ -2,350 +2,2019 @@
 #include "File_Input_Utility.h"
 #include "AVL_Tree_Utility.h"
 
-AvlTreeNodeType* clearTree(AvlTreeNodeType* wkgPtr)
+const char* accessBuildingRoom(const AvlTreeNodeType* nodePtr)
 {
-    // check if current node is not null
-    if ( !isEmpty( wkgPtr ) )
-    {    
-        // recurse left
-        clearTree( wkgPtr->leftChildPtr );
+    // text is found in string heap of owning arena
+    return nodePtr->arenaPtr->stringHeapPtr + nodePtr->buildingRoomOffset;
+}
 
-        // recurse right
-        clearTree( wkgPtr->rightChildPtr );
+const char* accessClassSetup(const AvlTreeNodeType* nodePtr)
+{
+    // initialize variables
+    ClassSetupDictionaryType *dictionaryPtr;
+    int setupId = nodePtr->classSetupId;
 
-        // clear node
-        free( wkgPtr );
+    // check for empty setup, never stored in dictionary
+    if ( setupId == EMPTY_CLASS_SETUP_ID )
+    {
+        // return empty string
+        return "";
     }
 
-    // return cleared tree ptr
-    return wkgPtr;
+    // find name in shared dictionary
+    dictionaryPtr = accessClassSetupDictionary();
+    return findClassSetupName( dictionaryPtr, setupId );
 }
 
-int compareRoomNumbers(const char* roomNbrOne, const char* roomNbrTwo)
+ClassSetupDictionaryType* accessClassSetupDictionary()
+{
+    // one dictionary shared by all trees, id zero is reserved
+    static ClassSetupDictionaryType classSetupDictionary 
+                    = { { NULL }, 1, NULL, 0, PTHREAD_MUTEX_INITIALIZER };
+
+    return &classSetupDictionary;
+}
+
+AvlTreeNodeType* allocateArenaNode(NodeArenaType* arenaPtr)
 {
     // initialize variables
-    int diffVal, index = 0;
+    AvlTreeNodeType *nodePtr;
+    NodeSlabType *slabPtr = arenaPtr->slabListPtr;
 
-    // loop until find the shortest string
-    while  ( roomNbrOne[ index ] != NULL_CHAR && 
-                                              roomNbrTwo[ index ] != NULL_CHAR )
+    // check for released node available
+    if ( arenaPtr->freeListPtr != NULL )
     {
-        // find difference
-        diffVal = roomNbrOne[ index ] - roomNbrTwo[ index ];
-        index++;
+        // take node from front of free list
+        nodePtr = arenaPtr->freeListPtr;
+        arenaPtr->freeListPtr = nodePtr->leftChildPtr;
 
-        // check for not zero
-        if ( diffVal != 0 )
-        {
-            // return it
-            return diffVal;
-        }
+        // node starts with the one link its caller makes to it
+        nodePtr->refCount = 1;
 
-        // check for left is digit
-        if ( isDigit( roomNbrOne[ index ] ) )
-        {
-            // return 1
-            return 1;
-        }
-        // check for right is digit
-        else if ( isDigit( roomNbrTwo[ index ] ) )
-        {
-            // return -1
-            return -1;
-        }
+        // return reused node
+        return nodePtr;
+    }
+
+    // check for no slab or current slab full
+    if ( slabPtr == NULL || slabPtr->usedCount == slabPtr->capacity )
+    {
+        // create new slab, add to front of slab list
+        slabPtr = (NodeSlabType *)malloc( sizeof(NodeSlabType) 
+                     + arenaPtr->nextSlabCapacity * sizeof(AvlTreeNodeType) );
+        slabPtr->capacity = arenaPtr->nextSlabCapacity;
+        slabPtr->usedCount = 0;
+        slabPtr->nextSlabPtr = arenaPtr->slabListPtr;
+        arenaPtr->slabListPtr = slabPtr;
+
+        // next slab is twice as large, up to limit
+        arenaPtr->nextSlabCapacity = findMin( 2 * arenaPtr->nextSlabCapacity,
+                                                            MAX_SLAB_CAPACITY );
     }
 
-    // return 0
-    return 0;
+    // take next node from current slab
+    nodePtr = &slabPtr->nodes[ slabPtr->usedCount ];
+    slabPtr->usedCount++;
+    nodePtr->refCount = 1;
+
+    // return new node
+    return nodePtr;
 }
 
-void copyString(char* dest, const char* source)
+AvlTreeNodeType* buildTreeFromRecordArray(RoomRecordType* recordArray,
+                                                                int numRecords)
 {
     // initialize variables
-    int index;
-    
-    // loop through string
-    for ( index = 0; source[index] != '\0'; index++ )
+    RoomRecordType **orderedPtrs;
+    AvlTreeNodeType *rootPtr;
+    int uniqueCount;
+
+    // check for no data
+    if ( numRecords <= 0 )
     {
-        dest[index] = source[index];
+        // return empty tree
+        return NULL;
     }
+
+    // find sorted, duplicate free order of records
+    orderedPtrs = createSortedRecordPointers( recordArray, numRecords, 
+                                                                &uniqueCount );
+
+    // build tree from sorted data into new arena
+    rootPtr = buildTreeFromSortedArray( createNodeArena(), orderedPtrs, 
+                                                           0, uniqueCount - 1 );
+
+    // release pointer array
+    free( orderedPtrs );
+
+    // return new tree
+    return rootPtr;
 }
 
-AvlTreeNodeType* copyTree(AvlTreeNodeType* rootPtr)
+AvlTreeNodeType* buildTreeFromSortedArray(NodeArenaType* arenaPtr,
+                 RoomRecordType** orderedPtrs, int lowIndex, int highIndex)
 {
     // initialize variables
     AvlTreeNodeType *newNode;
+    int midIndex;
 
-    // check if current node is null
-    if ( isEmpty( rootPtr ) )
+    // check for empty range
+    if ( lowIndex > highIndex )
     {
-        // create new node
-        newNode = createTreeNodeFromNode( *rootPtr );
+        // return empty subtree
+        return NULL;
+    }
 
-        // set left child
-        copyTree( rootPtr->leftChildPtr );
+    // find middle record, which becomes subtree root
+    midIndex = lowIndex + ( highIndex - lowIndex ) / 2;
+    newNode = createTreeNodeInArena( arenaPtr, 
+                                     orderedPtrs[ midIndex ]->roomNumber,
+                                     orderedPtrs[ midIndex ]->buildingRoom,
+                                     orderedPtrs[ midIndex ]->classSetup,
+                                     orderedPtrs[ midIndex ]->roomCapacity );
 
-        // set right child
-        copyTree( rootPtr->rightChildPtr );
-    }
+    // build left and right halves
+    newNode->leftChildPtr = buildTreeFromSortedArray( arenaPtr, orderedPtrs,
+                                                       lowIndex, midIndex - 1 );
+    newNode->rightChildPtr = buildTreeFromSortedArray( arenaPtr, orderedPtrs,
+                                                      midIndex + 1, highIndex );
 
-    // return pointer to new node
+    // set height, halves never differ by more than one
+    updateNodeHeight( newNode );
+
+    // return subtree
     return newNode;
 }
 
-AvlTreeNodeType* createTreeNodeFromData(const char* rmNumber,
-    const char* buildingRm, const char* clsSetup, int capacity)
+NodeArenaType* clearNodeArena(NodeArenaType* arenaPtr)
 {
-    // dynamically create new node
-    AvlTreeNodeType *newNode = (AvlTreeNodeType *)malloc(
-                                                       sizeof(AvlTreeNodeType));
+    // initialize variables
+    NodeSlabType *slabPtr;
 
-    // copy data into new node
-    copyString( newNode->roomNumber, rmNumber );
-    copyString( newNode->buildingRoom, buildingRm );
-    copyString( newNode->classSetup, clsSetup );
-    newNode->roomCapacity = capacity;
+    // loop across slab list
+    while ( arenaPtr->slabListPtr != NULL )
+    {
+        // unlink and release slab
+        slabPtr = arenaPtr->slabListPtr;
+        arenaPtr->slabListPtr = slabPtr->nextSlabPtr;
+        free( slabPtr );
+    }
 
-    // set child pointers to NULL
-    newNode->leftChildPtr = NULL;
-    newNode->rightChildPtr = NULL;
+    // release string heap
+    free( arenaPtr->stringHeapPtr );
 
-    // return new node
-    return newNode;
+    // release arena
+    free( arenaPtr );
+
+    // return cleared arena ptr
+    return NULL;
 }
 
-AvlTreeNodeType* createTreeNodeFromNode(const AvlTreeNodeType sourceNode)
+AvlTreeNodeType* clearTree(AvlTreeNodeType* wkgPtr)
+{
+    // initialize variables
+    NodeArenaType *arenaPtr;
+
+    // check if current node is not null
+    if ( !isEmpty( wkgPtr ) )
+    {    
+        arenaPtr = wkgPtr->arenaPtr;
+
+        // check for last tree using arena
+        if ( arenaPtr->numVersions == 1 )
+        {
+            // release every node of tree with its arena
+            clearNodeArena( arenaPtr );
+        }
+        // otherwise, other copies still use arena
+        else
+        {
+            // release only nodes no copy links to
+            arenaPtr->numVersions--;
+            releaseNodeReference( wkgPtr );
+        }
+    }
+
+    // return cleared tree ptr
+    return NULL;
+}
+
+int compareRecordKeys(const RoomRecordType* recordOne,
+                                               const RoomRecordType* recordTwo)
 {
-    return createTreeNodeFromData(sourceNode.roomNumber,sourceNode.buildingRoom,
-                                 sourceNode.classSetup,sourceNode.roomCapacity);
+    return compareRoomKeys( recordOne->roomKey, recordOne->roomNumber,
+                                    recordTwo->roomKey, recordTwo->roomNumber );
 }
 
-void displayChars(int numChars, char outChar)
+int compareRoomKeys(unsigned long long keyOne, const char* roomNbrOne,
+                            unsigned long long keyTwo, const char* roomNbrTwo)
 {
-    if ( numChars != 0 )
+    // check for both keys packed
+    if ( keyOne != NO_ROOM_KEY && keyTwo != NO_ROOM_KEY )
     {
-        printf("%c", outChar );
-        displayChars( numChars - 1, outChar );
+        // return sign of integer comparison
+        return ( keyOne > keyTwo ) - ( keyOne < keyTwo );
     }
+
+    // otherwise, compare strings
+    return compareRoomNumbers( roomNbrOne, roomNbrTwo );
 }
 
-int findBalanceFactor(AvlTreeNodeType* wkgPtr)
+int compareRoomNumbers(const char* roomNbrOne, const char* roomNbrTwo)
 {
-    return findTreeHeight( wkgPtr->leftChildPtr ) - 
-                                         findTreeHeight( wkgPtr->rightChildPtr);
+    // initialize variables
+    int diffVal, index = 0, runOne, runTwo;
+
+    // loop until find the shortest string
+    while  ( roomNbrOne[ index ] != NULL_CHAR && 
+                                              roomNbrTwo[ index ] != NULL_CHAR )
+    {
+        // check for digit runs starting in both strings
+        if ( isDigit( roomNbrOne[ index ] ) && isDigit( roomNbrTwo[ index ] ) )
+        {
+            // find length of both digit runs
+            for ( runOne = index; isDigit( roomNbrOne[ runOne ] ); runOne++ );
+            for ( runTwo = index; isDigit( roomNbrTwo[ runTwo ] ); runTwo++ );
+
+            // check for longer digit run, longer number is greater
+            if ( runOne != runTwo )
+            {
+                // return it
+                return runOne - runTwo;
+            }
+
+            // same length digit runs compare character by character
+            while ( index < runOne )
+            {
+                // find difference
+                diffVal = roomNbrOne[ index ] - roomNbrTwo[ index ];
+                index++;
+
+                // check for not zero
+                if ( diffVal != 0 )
+                {
+                    // return it
+                    return diffVal;
+                }
+            }
+        }
+        // otherwise, compare single characters
+        else
+        {
+            // find difference
+            diffVal = roomNbrOne[ index ] - roomNbrTwo[ index ];
+            index++;
+
+            // check for not zero
+            if ( diffVal != 0 )
+            {
+                // return it
+                return diffVal;
+            }
+        }
+    }
+
+    // equal so far, longer one is greater, otherwise zero
+    return roomNbrOne[ index ] - roomNbrTwo[ index ];
 }
 
-int findMax(int one, int other)
+void copyArenaStrings(NodeArenaType* destArenaPtr, 
+                                              const NodeArenaType* srcArenaPtr)
 {
-    if ( one > other )
+    // initialize variables
+    unsigned int index;
+
+    // check for no text stored
+    if ( srcArenaPtr->heapUsed == 0 )
     {
-        return one;
+        return;
     }
-    else
+
+    // give empty heap same size as source
+    destArenaPtr->heapCapacity = srcArenaPtr->heapCapacity;
+    destArenaPtr->heapUsed = srcArenaPtr->heapUsed;
+    destArenaPtr->stringHeapPtr = (char *)malloc( 
+                                                 destArenaPtr->heapCapacity );
+
+    // copy text as is, so offsets stay the same
+    for ( index = 0; index < srcArenaPtr->heapUsed; index++ )
     {
-        return other;
+        destArenaPtr->stringHeapPtr[ index ] 
+                                       = srcArenaPtr->stringHeapPtr[ index ];
     }
 }
 
-int findTreeHeight(AvlTreeNodeType* wkgPtr)
+void copyString(char* dest, const char* source)
 {
     // initialize variables
-    int leftHeight, rightHeight, maxHeight;
+    int index;
+    
+    // loop through string
+    for ( index = 0; source[index] != '\0'; index++ )
+    {
+        dest[index] = source[index];
+    }
 
-    // if current ptr is not NULL
-    if ( !isEmpty( wkgPtr ) )
-	{
-	    // get height of left child
-        leftHeight = findTreeHeight( wkgPtr->leftChildPtr );
+    // terminate destination string
+    dest[index] = '\0';
+}
 
-	    // get height of right child
-        rightHeight = findTreeHeight( wkgPtr->rightChildPtr );
+int copyStringWithLimit(char* dest, const char* source, int capacity)
+{
+    // initialize variables
+    int index;
 
-	    // find max between them
-        maxHeight = findMax( leftHeight, rightHeight );
+    // loop through string, leaving room for terminator
+    for ( index = 0; source[ index ] != NULL_CHAR && index < capacity - 1;
+                                                                       index++ )
+    {
+        dest[ index ] = source[ index ];
+    }
 
-	    // return max plus one
-        return maxHeight + 1;
-	}
+    // terminate destination string
+    dest[ index ] = NULL_CHAR;
 
-    return -1;
+    // return number of characters copied
+    return index;
 }
 
-AvlTreeNodeType* initializeTree()
+AvlTreeNodeType* copyTree(AvlTreeNodeType* rootPtr)
 {
-    return NULL;
+    // check if tree is empty
+    if ( isEmpty( rootPtr ) )
+    {
+        // return empty copy
+        return NULL;
+    }
+
+    // copy shares every node, nodes are copied only when changed
+    rootPtr->refCount++;
+    rootPtr->arenaPtr->numVersions++;
+
+    // return same root, now linked from both trees
+    return rootPtr;
 }
 
-void inOrderDisplay(AvlTreeNodeType* wkgPtr)
+AvlTreeNodeType* copyTreeDeep(AvlTreeNodeType* rootPtr)
 {
-    // check if current node is not null
-    if ( !isEmpty( wkgPtr ) )
-    {    
-        // recurse left
-        inOrderDisplay( wkgPtr->leftChildPtr );
-
-        // print current node
-        printf( "%s, ", wkgPtr->roomNumber );
+    // initialize variables
+    NodeArenaType *arenaPtr;
 
-        // recurse right
-        inOrderDisplay( wkgPtr->rightChildPtr );
+    // check if tree is empty
+    if ( isEmpty( rootPtr ) )
+    {
+        // return empty copy
+        return NULL;
     }
-    // print new line
-    printf("\n");
+
+    // copy text into new arena owned by copy, then all nodes
+    arenaPtr = createNodeArena();
+    copyArenaStrings( arenaPtr, rootPtr->arenaPtr );
+
+    return copyTreeIntoArena( arenaPtr, arenaPtr, rootPtr );
 }
 
-AvlTreeNodeType* insert(AvlTreeNodeType* wkgPtr,
-    char* rmNmbr, char* bldgRm, char* clsSetup, int capacity)
+AvlTreeNodeType* copyTreeIntoArena(NodeArenaType* slabArenaPtr,
+                         NodeArenaType* arenaPtr, AvlTreeNodeType* wkgPtr)
 {
     // initialize variables
     AvlTreeNodeType *newNode;
-    int comparisonVal, balanceFactor;
 
-    // check for working pointer null
+    // check if current node is null
     if ( isEmpty( wkgPtr ) )
     {
-        // create and return new node
-        newNode = createTreeNodeFromData( rmNmbr, bldgRm, clsSetup, capacity );
+        // return empty subtree
+        return NULL;
     }
 
-    // find comparison value
-    comparisonVal = compareRoomNumbers( wkgPtr->roomNumber, rmNmbr );
+    // create new node with same data, text offset and setup id
+    newNode = allocateArenaNode( slabArenaPtr );
+    *newNode = *wkgPtr;
+    newNode->refCount = 1;
+    newNode->arenaPtr = arenaPtr;
 
-    // check for room number less than current
-    if ( comparisonVal > 0 )
+    // set left child
+    newNode->leftChildPtr = copyTreeIntoArena( slabArenaPtr, arenaPtr, 
+                                                        wkgPtr->leftChildPtr );
+
+    // set right child
+    newNode->rightChildPtr = copyTreeIntoArena( slabArenaPtr, arenaPtr, 
+                                                       wkgPtr->rightChildPtr );
+
+    // return pointer to new node
+    return newNode;
+}
+
+AvlTreeNodeType* copyTreeParallel(AvlTreeNodeType* rootPtr, int numThreads)
+{
+    // initialize variables
+    TreeCopyQueueType copyQueue;
+    pthread_t *threadArray;
+    AvlTreeNodeType *newRootPtr;
+    int splitDepth = 0, numStarted = 0, index;
+
+    // check for tree too small to gain from threads
+    if ( isEmpty( rootPtr ) || numThreads < 2 
+                            || rootPtr->height < PARALLEL_COPY_MIN_HEIGHT )
     {
-        // call left recursion, assign to left child pointer
-        wkgPtr->leftChildPtr = insert( wkgPtr->leftChildPtr, 
-           wkgPtr->leftChildPtr->roomNumber, wkgPtr->leftChildPtr->buildingRoom,
-                                           wkgPtr->leftChildPtr->classSetup, 
-                                           wkgPtr->leftChildPtr->roomCapacity );
+        // copy on this thread
+        return copyTreeDeep( rootPtr );
     }
-    // otherwise, check for room number greater than current
-    else if ( comparisonVal < 0 )
+
+    // split deep enough for several subtrees per thread, 
+    // subtrees at one depth of AVL tree differ in size
+    while ( ( 1 << splitDepth ) < numThreads * COPY_TASKS_PER_THREAD )
     {
-        // call right recursion, assign to right child pointer
-        wkgPtr->rightChildPtr = insert( wkgPtr->rightChildPtr, 
-         wkgPtr->rightChildPtr->roomNumber, wkgPtr->rightChildPtr->buildingRoom,
-                                          wkgPtr->rightChildPtr->classSetup,
-                                          wkgPtr->rightChildPtr->roomCapacity );
+        splitDepth++;
     }
-    // otherwise, assume duplicate item found
-    else
+
+    // copy text into new arena owned by copy
+    copyQueue.arenaPtr = createNodeArena();
+    copyArenaStrings( copyQueue.arenaPtr, rootPtr->arenaPtr );
+
+    // copy top levels here, leaving one task per subtree below them
+    copyQueue.taskArray = (TreeCopyTaskType *)malloc( 
+                               ( 1 << splitDepth ) * sizeof(TreeCopyTaskType) );
+    copyQueue.numTasks = 0;
+    copyQueue.nextTaskIndex = 0;
+    pthread_mutex_init( &copyQueue.queueLock, NULL );
+
+    copyTreeTopLevels( &copyQueue, rootPtr, &newRootPtr, splitDepth );
+
+    // no more threads than tasks
+    numThreads = findMin( numThreads, copyQueue.numTasks );
+
+    threadArray = (pthread_t *)malloc( numThreads * sizeof(pthread_t) );
+
+    // start workers, this thread is one of them
+    for ( index = 1; index < numThreads; index++ )
     {
-        // return working pointer
-        return wkgPtr;
+        // check for worker started
+        if ( pthread_create( &threadArray[ numStarted ], NULL, 
+                                            copyTreeTasks, &copyQueue ) == 0 )
+        {
+            numStarted++;
+        }
     }
-    // find balance factor
-    balanceFactor = findBalanceFactor( wkgPtr );
 
-    // check for left left case
-    if ( balanceFactor > 1 && rmNmbr < wkgPtr->roomNumber )
+    // copy subtrees here too, so all are copied even if none started,
+    // then wait for workers that did start
+    copyTreeTasks( &copyQueue );
+
+    for ( index = 0; index < numStarted; index++ )
     {
-        // rotate current to the right and return
-        return rotateRight( wkgPtr );
+        pthread_join( threadArray[ index ], NULL );
     }
-    // check for right right case
-    else if ( balanceFactor < -1 && rmNmbr > wkgPtr->roomNumber )
-    {
-        displayChars( findTreeHeight( wkgPtr ), SPACE );
-        printf( "Identified: Right Right Case\n" );
 
-        // rotate current pointer to the left and return
-        return rotateLeft( wkgPtr );
-    }
-    // check for left right case
-    else if ( balanceFactor > 1 && rmNmbr > wkgPtr->roomNumber )
-    {
-        // rotate current pointer's left child to the left, assign to left child
-        wkgPtr->leftChildPtr = rotateLeft( wkgPtr->leftChildPtr );
+    free( threadArray );
+    pthread_mutex_destroy( &copyQueue.queueLock );
 
-        // rotate current pointer to the right and return
-        return rotateRight( wkgPtr );
-    }
-    // check for right left case
-    else if ( balanceFactor < -1 && rmNmbr < wkgPtr->roomNumber )
+    // hand slabs of each subtree to arena owned by copy
+    for ( index = 0; index < copyQueue.numTasks; index++ )
     {
-        // rotate working pointer's right child to the right
-        // assign to the righ child
-        wkgPtr->rightChildPtr = rotateRight( wkgPtr->rightChildPtr );
-
-        // rotate current pointer to the left and return
-        return rotateLeft( wkgPtr );
+        mergeNodeArenas( copyQueue.arenaPtr, 
+                                  copyQueue.taskArray[ index ].slabArenaPtr );
     }
 
-    return newNode;
-}
-
-bool isDigit(char testChar)
-{
-    return testChar >= '0' && testChar <= '9';
-}
+    free( copyQueue.taskArray );
 
-bool isEmpty(AvlTreeNodeType* rootPtr)
-{
-    return rootPtr == NULL;
+    // return copied tree
+    return newRootPtr;
 }
 
-AvlTreeNodeType* rotateLeft(AvlTreeNodeType* oldParentPtr)
+void* copyTreeTasks(void* queuePtr)
 {
     // initialize variables
-    AvlTreeNodeType *tempPtr;
+    TreeCopyQueueType *copyQueue = (TreeCopyQueueType *)queuePtr;
+    TreeCopyTaskType *taskPtr;
+    int taskIndex;
 
-    // print output text
-    printf( "- Rotating Left" );
+    while ( true )
+    {
+        // take next subtree from queue
+        pthread_mutex_lock( &copyQueue->queueLock );
 
-    // set temp pointer to right child
-    tempPtr = oldParentPtr->rightChildPtr;
+        taskIndex = copyQueue->nextTaskIndex;
+        copyQueue->nextTaskIndex++;
 
-    // set left child of right child to old parent
-    oldParentPtr->rightChildPtr->leftChildPtr = oldParentPtr;
+        pthread_mutex_unlock( &copyQueue->queueLock );
 
-    // set right child of old parent to null
-    oldParentPtr->rightChildPtr = NULL;
+        // check for no subtrees remaining
+        if ( taskIndex >= copyQueue->numTasks )
+        {
+            return NULL;
+        }
 
-    // return rotated tree
-    return tempPtr;
+        // copy subtree into slabs of its own, nodes belong to copy's arena
+        taskPtr = &copyQueue->taskArray[ taskIndex ];
+        taskPtr->slabArenaPtr = createNodeArena();
+
+        *taskPtr->destPtrPtr = copyTreeIntoArena( taskPtr->slabArenaPtr,
+                                     copyQueue->arenaPtr, taskPtr->sourcePtr );
+    }
 }
 
-AvlTreeNodeType* rotateRight(AvlTreeNodeType* oldParentPtr)
+void copyTreeTopLevels(TreeCopyQueueType* copyQueue, AvlTreeNodeType* wkgPtr,
+                                  AvlTreeNodeType** destPtrPtr, int depth)
 {
     // initialize variables
-    AvlTreeNodeType *tempPtr;
+    TreeCopyTaskType *taskPtr;
+    AvlTreeNodeType *newNode;
+
+    // check for empty subtree
+    if ( isEmpty( wkgPtr ) )
+    {
+        *destPtrPtr = NULL;
 
-    // print output text
-    printf( "- Rotating Right" );
+        return;
+    }
 
-    // set temp pointer to left child
-    tempPtr = oldParentPtr->leftChildPtr;
+    // check for split depth reached
+    if ( depth == 0 )
+    {
+        // leave subtree for a worker, which sets link when done
+        taskPtr = &copyQueue->taskArray[ copyQueue->numTasks ];
+        taskPtr->sourcePtr = wkgPtr;
+        taskPtr->destPtrPtr = destPtrPtr;
+        taskPtr->slabArenaPtr = NULL;
+        copyQueue->numTasks++;
 
-    // set right child of left child to old parent
-    oldParentPtr->leftChildPtr->rightChildPtr = oldParentPtr;
+        return;
+    }
 
-    // set left child of old parent to null
-    oldParentPtr->leftChildPtr = NULL;
+    // create new node with same data in arena owned by copy
+    newNode = allocateArenaNode( copyQueue->arenaPtr );
+    *newNode = *wkgPtr;
+    newNode->refCount = 1;
+    newNode->arenaPtr = copyQueue->arenaPtr;
+    *destPtrPtr = newNode;
 
-    // return rotated tree
-    return tempPtr;
+    // copy or leave tasks for both children
+    copyTreeTopLevels( copyQueue, wkgPtr->leftChildPtr, 
+                                       &newNode->leftChildPtr, depth - 1 );
+    copyTreeTopLevels( copyQueue, wkgPtr->rightChildPtr, 
+                                      &newNode->rightChildPtr, depth - 1 );
 }
 
-AvlTreeNodeType* search(AvlTreeNodeType* wkgPtr, const char* roomNumber)
+int countTreeNodes(AvlTreeNodeType* wkgPtr)
 {
-    // check if null
+    // check if current node is null
     if ( isEmpty( wkgPtr ) )
     {
-        // return pointer
-        return NULL;
-    }
-    // check if search data is greater
-    if ( compareRoomNumbers( roomNumber, wkgPtr->roomNumber ) > 0 )
-    {
-        // recurse right
-        return search( wkgPtr->rightChildPtr, roomNumber );
+        // return none
+        return 0;
     }
-    // check if search data is smaller
-    else
-    {
-        // recurse left
-        return search( wkgPtr->leftChildPtr, roomNumber );
+
+    // return current node plus both subtrees
+    return 1 + countTreeNodes( wkgPtr->leftChildPtr ) 
+                                   + countTreeNodes( wkgPtr->rightChildPtr );
+}
+
+NodeArenaType* createNodeArena()
+{
+    // dynamically create new arena
+    NodeArenaType *arenaPtr = (NodeArenaType *)malloc( sizeof(NodeArenaType) );
+
+    // start with no slabs and nothing released
+    arenaPtr->slabListPtr = NULL;
+    arenaPtr->freeListPtr = NULL;
+    arenaPtr->nextSlabCapacity = INITIAL_SLAB_CAPACITY;
+
+    // arena is used by the one tree it is created for
+    arenaPtr->numVersions = 1;
+
+    // string heap is created with first stored string
+    arenaPtr->stringHeapPtr = NULL;
+    arenaPtr->heapUsed = 0;
+    arenaPtr->heapCapacity = 0;
+
+    // return new arena
+    return arenaPtr;
+}
+
+unsigned long long createRoomKey(const char* roomNumber)
+{
+    // initialize variables
+    unsigned long long buildingValue = 0, letterValue = 0, roomValue = 0;
+    int index = 0, buildingLength, roomStart;
+
+    // capture building digits
+    while ( isDigit( roomNumber[ index ] ) && index < MAX_KEY_BUILDING_DIGITS )
+    {
+        buildingValue = buildingValue * 10 + ( roomNumber[ index ] - '0' );
+        index++;
+    }
+
+    buildingLength = index;
+
+    // check for building number followed by dash
+    if ( buildingLength == 0 || roomNumber[ index ] != DASH )
+    {
+        // shape not supported
+        return NO_ROOM_KEY;
+    }
+
+    index++;
+
+    // capture optional letter, always orders after a digit
+    if ( ( roomNumber[ index ] >= 'A' && roomNumber[ index ] <= 'Z' )
+              || ( roomNumber[ index ] >= 'a' && roomNumber[ index ] <= 'z' ) )
+    {
+        letterValue = (unsigned long long)roomNumber[ index ];
+        index++;
+    }
+
+    // capture room digits
+    roomStart = index;
+
+    while ( isDigit( roomNumber[ index ] ) 
+                                && index - roomStart < MAX_KEY_ROOM_DIGITS )
+    {
+        roomValue = roomValue * 10 + ( roomNumber[ index ] - '0' );
+        index++;
+    }
+
+    // check for room digits running to end of string
+    if ( index == roomStart || roomNumber[ index ] != NULL_CHAR )
+    {
+        // shape not supported
+        return NO_ROOM_KEY;
+    }
+
+    // pack fields, digit run lengths ahead of values as in natural order
+    return ( 1ULL << ROOM_KEY_VALID_SHIFT )
+           | ( (unsigned long long)buildingLength 
+                                              << ROOM_KEY_BUILDING_LEN_SHIFT )
+           | ( buildingValue << ROOM_KEY_BUILDING_SHIFT )
+           | ( letterValue << ROOM_KEY_LETTER_SHIFT )
+           | ( (unsigned long long)( index - roomStart ) 
+                                                  << ROOM_KEY_ROOM_LEN_SHIFT )
+           | ( roomValue << ROOM_KEY_ROOM_SHIFT );
+}
+
+RoomRecordType** createSortedRecordPointers(RoomRecordType* recordArray,
+                                         int numRecords, int* uniqueCountPtr)
+{
+    // initialize variables
+    RoomRecordType **orderedPtrs;
+    bool isForward = true, isBackward = true;
+    int index, uniqueCount, comparisonVal;
+
+    // create pointer array so records are never moved
+    orderedPtrs = (RoomRecordType **)malloc(
+                                        numRecords * sizeof(RoomRecordType *));
+
+    // set ordering key of each record once
+    for ( index = 0; index < numRecords; index++ )
+    {
+        recordArray[ index ].roomKey = 
+                               createRoomKey( recordArray[ index ].roomNumber );
+    }
+
+    // find existing order of records, one pass
+    for ( index = 1; index < numRecords; index++ )
+    {
+        // find comparison of neighbors
+        comparisonVal = compareRecordKeys( &recordArray[ index - 1 ], 
+                                                       &recordArray[ index ] );
+
+        // duplicates are allowed in forward order, first one is kept
+        isForward = isForward && comparisonVal <= 0;
+        isBackward = isBackward && comparisonVal > 0;
+    }
+
+    // load pointers, reversed for backward input
+    for ( index = 0; index < numRecords; index++ )
+    {
+        orderedPtrs[ index ] = isBackward && !isForward
+                                    ? &recordArray[ numRecords - 1 - index ] 
+                                    : &recordArray[ index ];
+    }
+
+    // check for unsorted input
+    if ( !isForward && !isBackward )
+    {
+        // stable sort, so first of any duplicates stays first
+        sortRecordArray( orderedPtrs, numRecords );
+    }
+
+    // remove duplicates, keeping first as insert does
+    uniqueCount = findMin( numRecords, 1 );
+
+    for ( index = 1; index < numRecords; index++ )
+    {
+        if ( compareRecordKeys( orderedPtrs[ uniqueCount - 1 ], 
+                                                  orderedPtrs[ index ] ) != 0 )
+        {
+            orderedPtrs[ uniqueCount ] = orderedPtrs[ index ];
+            uniqueCount++;
+        }
+    }
+
+    // return sorted pointers and count
+    *uniqueCountPtr = uniqueCount;
+    return orderedPtrs;
+}
+
+AvlTreeNodeType* createTreeNodeFromData(const char* rmNumber,
+    const char* buildingRm, const char* clsSetup, int capacity)
+{
+    // create node as only node of new arena
+    return createTreeNodeInArena( createNodeArena(), 
+                                     rmNumber, buildingRm, clsSetup, capacity );
+}
+
+AvlTreeNodeType* createTreeNodeFromNode(const AvlTreeNodeType sourceNode)
+{
+    return createTreeNodeFromData( sourceNode.roomNumber, 
+                                   accessBuildingRoom( &sourceNode ),
+                                   accessClassSetup( &sourceNode ),
+                                   sourceNode.roomCapacity );
+}
+
+AvlTreeNodeType* createTreeNodeInArena(NodeArenaType* arenaPtr,
+    const char* rmNumber, const char* buildingRm, const char* clsSetup, 
+                                                                   int capacity)
+{
+    // initialize variables
+    int buildingRoomLength;
+
+    // create new node from arena
+    AvlTreeNodeType *newNode = allocateArenaNode( arenaPtr );
+
+    // record owning arena
+    newNode->arenaPtr = arenaPtr;
+
+    // copy data into new node, find ordering key once
+    copyString( newNode->roomNumber, rmNumber );
+    newNode->roomKey = createRoomKey( rmNumber );
+    newNode->roomCapacity = capacity;
+
+    // store building/room text in arena, class setup as dictionary id
+    newNode->buildingRoomOffset = storeArenaString( arenaPtr, buildingRm, 
+                              BUILDING_ROOM_CAPACITY, &buildingRoomLength );
+    newNode->buildingRoomLength = (unsigned char)buildingRoomLength;
+    newNode->classSetupId = internClassSetup( clsSetup );
+
+    // new node is a leaf
+    newNode->height = 0;
+
+    // set child pointers to NULL
+    newNode->leftChildPtr = NULL;
+    newNode->rightChildPtr = NULL;
+
+    // return new node
+    return newNode;
+}
+
+AvlTreeNodeType* detachMinNode(AvlTreeNodeType* wkgPtr, 
+                                          AvlTreeNodeType** minNodePtrPtr)
+{
+    // node is changed either way, copy it first if shared
+    wkgPtr = unshareNode( wkgPtr );
+
+    // check for smallest node found
+    if ( isEmpty( wkgPtr->leftChildPtr ) )
+    {
+        // hand back node, its right subtree takes its place
+        *minNodePtrPtr = wkgPtr;
+        return wkgPtr->rightChildPtr;
+    }
+
+    // call left recursion, assign to left child pointer
+    wkgPtr->leftChildPtr = detachMinNode( wkgPtr->leftChildPtr, 
+                                                             minNodePtrPtr );
+
+    // return subtree balanced on the way back up
+    return rebalanceNode( wkgPtr );
+}
+
+void displayChars(int numChars, char outChar)
+{
+    // initialize variables
+    BufferedOutputWriterType *writerPtr = accessDefaultOutputWriter();
+
+    // write characters, show them before any following printf
+    writeRepeatedCharacterToBufferedWriter( writerPtr, outChar, numChars );
+    flushBufferedWriter( writerPtr );
+}
+
+int findBalanceFactor(AvlTreeNodeType* wkgPtr)
+{
+    return findTreeHeight( wkgPtr->leftChildPtr ) - 
+                                        findTreeHeight( wkgPtr->rightChildPtr );
+}
+
+AvlTreeNodeType* findCeiling(AvlTreeNodeType* rootPtr, const char* roomNumber)
+{
+    // return smallest node at or above room number
+    return findNeighborNode( rootPtr, roomNumber, true, true );
+}
+
+char* findClassSetupName(ClassSetupDictionaryType* dictionaryPtr, 
+                                                                   int setupId)
+{
+    // find name by page and slot of id
+    return ( *dictionaryPtr->pagePtrs[ setupId / SETUP_PAGE_SIZE ] )
+                                                  [ setupId % SETUP_PAGE_SIZE ];
+}
+
+AvlTreeNodeType* findFloor(AvlTreeNodeType* rootPtr, const char* roomNumber)
+{
+    // return largest node at or below room number
+    return findNeighborNode( rootPtr, roomNumber, false, true );
+}
+
+int findMax(int one, int other)
+{
+    if ( one > other )
+    {
+        return one;
+    }
+    else
+    {
+        return other;
+    }
+}
+
+int findMin(int one, int other)
+{
+    if ( one < other )
+    {
+        return one;
+    }
+    else
+    {
+        return other;
+    }
+}
+
+AvlTreeNodeType* findNeighborNode(AvlTreeNodeType* rootPtr, 
+                       const char* roomNumber, bool aboveFlag, bool equalFlag)
+{
+    // initialize variables
+    AvlTreeNodeType *wkgPtr = rootPtr, *candidatePtr = NULL;
+    unsigned long long searchKey = createRoomKey( roomNumber );
+    int comparisonVal;
+
+    // loop down one path
+    while ( !isEmpty( wkgPtr ) )
+    {
+        // find comparison value
+        comparisonVal = compareRoomKeys( searchKey, roomNumber, 
+                                          wkgPtr->roomKey, wkgPtr->roomNumber );
+
+        // check for equal node that is allowed
+        if ( comparisonVal == 0 && equalFlag )
+        {
+            // return it
+            return wkgPtr;
+        }
+
+        // node above room number, keep it if looking above, go left
+        if ( comparisonVal < 0 )
+        {
+            if ( aboveFlag )
+            {
+                candidatePtr = wkgPtr;
+            }
+
+            wkgPtr = wkgPtr->leftChildPtr;
+        }
+        // node below room number, keep it if looking below, go right
+        else if ( comparisonVal > 0 )
+        {
+            if ( !aboveFlag )
+            {
+                candidatePtr = wkgPtr;
+            }
+
+            wkgPtr = wkgPtr->rightChildPtr;
+        }
+        // equal node not allowed, neighbor is in subtree on wanted side
+        else
+        {
+            wkgPtr = aboveFlag ? wkgPtr->rightChildPtr : wkgPtr->leftChildPtr;
+        }
+    }
+
+    // return closest node kept
+    return candidatePtr;
+}
+
+AvlTreeNodeType* findPredecessor(AvlTreeNodeType* rootPtr, 
+                                                        const char* roomNumber)
+{
+    // return largest node below room number
+    return findNeighborNode( rootPtr, roomNumber, false, false );
+}
+
+unsigned int findStringHash(const char* text)
+{
+    // initialize variables, FNV-1a offset basis
+    unsigned int hashVal = 2166136261u;
+    int index;
+
+    // mix in each character
+    for ( index = 0; text[ index ] != NULL_CHAR; index++ )
+    {
+        hashVal = ( hashVal ^ (unsigned char)text[ index ] ) * 16777619u;
+    }
+
+    // return hash
+    return hashVal;
+}
+
+AvlTreeNodeType* findSuccessor(AvlTreeNodeType* rootPtr, 
+                                                        const char* roomNumber)
+{
+    // return smallest node above room number
+    return findNeighborNode( rootPtr, roomNumber, true, false );
+}
+
+int findTreeHeight(AvlTreeNodeType* wkgPtr)
+{
+    // if current ptr is not NULL
+    if ( !isEmpty( wkgPtr ) )
+    {
+        // return height stored in node
+        return wkgPtr->height;
+    }
+
+    return -1;
+}
+
+AvlTreeNodeType* getNextTreeNode(TreeIteratorType* iteratorPtr)
+{
+    // initialize variables
+    AvlTreeNodeType *nodePtr;
+
+    // check for no nodes left
+    if ( isIteratorDone( iteratorPtr ) )
+    {
+        return NULL;
+    }
+
+    // take deepest waiting node
+    iteratorPtr->stackTop--;
+    nodePtr = iteratorPtr->stackPtrs[ iteratorPtr->stackTop ];
+
+    // nodes of right subtree come next
+    loadLeftPath( iteratorPtr, nodePtr->rightChildPtr );
+
+    // return node
+    return nodePtr;
+}
+
+AvlTreeNodeType* initializeTree()
+{
+    return NULL;
+}
+
+void initializeTreeIterator(TreeIteratorType* iteratorPtr, 
+                                                      AvlTreeNodeType* rootPtr)
+{
+    // start with empty stack
+    iteratorPtr->stackTop = 0;
+
+    // smallest node ends up on top
+    loadLeftPath( iteratorPtr, rootPtr );
+}
+
+void inOrderDisplay(AvlTreeNodeType* wkgPtr)
+{
+    // initialize variables
+    BufferedOutputWriterType *writerPtr = accessDefaultOutputWriter();
+
+    // write room numbers, then one new line
+    writeInOrderRoomNumbers( writerPtr, wkgPtr );
+    writeCharacterToBufferedWriter( writerPtr, NEWLINE_CHAR );
+
+    // show them before any following printf
+    flushBufferedWriter( writerPtr );
+}
+
+AvlTreeNodeType* insert(AvlTreeNodeType* wkgPtr,
+    char* rmNmbr, char* bldgRm, char* clsSetup, int capacity)
+{
+    // initialize variables
+    NodeArenaType *arenaPtr;
+
+    // check for empty tree
+    if ( isEmpty( wkgPtr ) )
+    {
+        // new tree gets new arena
+        arenaPtr = createNodeArena();
+    }
+    // otherwise, check for duplicate in tree shared with copies
+    else if ( wkgPtr->arenaPtr->numVersions > 1 
+                                           && search( wkgPtr, rmNmbr ) != NULL )
+    {
+        // return tree unchanged, no path is copied
+        return wkgPtr;
+    }
+    // otherwise, use arena owned by tree
+    else
+    {
+        arenaPtr = wkgPtr->arenaPtr;
+    }
+
+    // insert into tree with ordering key found once, return new root
+    return insertInArena( arenaPtr, wkgPtr, createRoomKey( rmNmbr ),
+                                         rmNmbr, bldgRm, clsSetup, capacity );
+}
+
+AvlTreeNodeType* insertInArena(NodeArenaType* arenaPtr, AvlTreeNodeType* wkgPtr,
+    unsigned long long roomKey, 
+                    char* rmNmbr, char* bldgRm, char* clsSetup, int capacity)
+{
+    // initialize variables
+    int comparisonVal, balanceFactor;
+
+    // check for working pointer null
+    if ( isEmpty( wkgPtr ) )
+    {
+        // create and return new node
+        return createTreeNodeInArena( arenaPtr, 
+                                         rmNmbr, bldgRm, clsSetup, capacity );
+    }
+
+    // find comparison value
+    comparisonVal = compareRoomKeys( wkgPtr->roomKey, wkgPtr->roomNumber, 
+                                                             roomKey, rmNmbr );
+
+    // check for duplicate item found
+    if ( comparisonVal == 0 )
+    {
+        // return working pointer
+        return wkgPtr;
+    }
+
+    // node on insert path is changed, copy it first if shared
+    wkgPtr = unshareNode( wkgPtr );
+
+    // check for room number less than current
+    if ( comparisonVal > 0 )
+    {
+        // call left recursion, assign to left child pointer
+        wkgPtr->leftChildPtr = insertInArena( arenaPtr, wkgPtr->leftChildPtr,
+                                roomKey, rmNmbr, bldgRm, clsSetup, capacity );
+    }
+    // otherwise, room number greater than current
+    else
+    {
+        // call right recursion, assign to right child pointer
+        wkgPtr->rightChildPtr = insertInArena( arenaPtr, wkgPtr->rightChildPtr,
+                                roomKey, rmNmbr, bldgRm, clsSetup, capacity );
+    }
+
+    // update stored height on the way back up
+    updateNodeHeight( wkgPtr );
+
+    // find balance factor
+    balanceFactor = findBalanceFactor( wkgPtr );
+
+    // check for left left case
+    if ( balanceFactor > 1 
+          && compareRoomKeys( roomKey, rmNmbr, wkgPtr->leftChildPtr->roomKey, 
+                                     wkgPtr->leftChildPtr->roomNumber ) < 0 )
+    {
+        // rotate current to the right and return
+        return rotateRight( wkgPtr );
+    }
+    // check for right right case
+    else if ( balanceFactor < -1 
+         && compareRoomKeys( roomKey, rmNmbr, wkgPtr->rightChildPtr->roomKey, 
+                                    wkgPtr->rightChildPtr->roomNumber ) > 0 )
+    {
+        LOG_TRACE( "%*sIdentified: Right Right Case", 
+                                              findTreeHeight( wkgPtr ), "" );
+
+        // rotate current pointer to the left and return
+        return rotateLeft( wkgPtr );
+    }
+    // check for left right case
+    else if ( balanceFactor > 1 )
+    {
+        // rotate current pointer's left child to the left, assign to left child
+        wkgPtr->leftChildPtr = rotateLeft( wkgPtr->leftChildPtr );
+
+        // rotate current pointer to the right and return
+        return rotateRight( wkgPtr );
+    }
+    // check for right left case
+    else if ( balanceFactor < -1 )
+    {
+        // rotate working pointer's right child to the right
+        // assign to the righ child
+        wkgPtr->rightChildPtr = rotateRight( wkgPtr->rightChildPtr );
+
+        // rotate current pointer to the left and return
+        return rotateLeft( wkgPtr );
+    }
+
+    return wkgPtr;
+}
+
+unsigned short internClassSetup(const char* setupName)
+{
+    // initialize variables
+    ClassSetupDictionaryType *dictionaryPtr = accessClassSetupDictionary();
+    int setupId, slotIndex, mask;
+
+    // check for empty setup
+    if ( setupName[ 0 ] == NULL_CHAR )
+    {
+        // return reserved id
+        return EMPTY_CLASS_SETUP_ID;
+    }
+
+    pthread_mutex_lock( &dictionaryPtr->dictionaryLock );
+
+    // keep index at most half full
+    if ( 2 * dictionaryPtr->numSetups >= dictionaryPtr->indexCapacity )
+    {
+        resizeClassSetupIndex( dictionaryPtr );
+    }
+
+    // probe index from hash slot
+    mask = dictionaryPtr->indexCapacity - 1;
+    slotIndex = (int)( findStringHash( setupName ) & (unsigned int)mask );
+
+    while ( dictionaryPtr->indexTable[ slotIndex ] != EMPTY_CLASS_SETUP_ID )
+    {
+        setupId = dictionaryPtr->indexTable[ slotIndex ];
+
+        // check for setup already in dictionary
+        if ( isSameString( setupName, 
+                               findClassSetupName( dictionaryPtr, setupId ) ) )
+        {
+            pthread_mutex_unlock( &dictionaryPtr->dictionaryLock );
+
+            // return existing id
+            return (unsigned short)setupId;
+        }
+
+        slotIndex = ( slotIndex + 1 ) & mask;
+    }
+
+    // check for dictionary full
+    if ( dictionaryPtr->numSetups == MAX_CLASS_SETUPS )
+    {
+        pthread_mutex_unlock( &dictionaryPtr->dictionaryLock );
+
+        // setup cannot be kept
+        return EMPTY_CLASS_SETUP_ID;
+    }
+
+    // take next id, creating its page as needed
+    setupId = dictionaryPtr->numSetups;
+
+    if ( dictionaryPtr->pagePtrs[ setupId / SETUP_PAGE_SIZE ] == NULL )
+    {
+        dictionaryPtr->pagePtrs[ setupId / SETUP_PAGE_SIZE ] = 
+                 (ClassSetupPageType *)malloc( sizeof(ClassSetupPageType) );
+    }
+
+    copyStringWithLimit( findClassSetupName( dictionaryPtr, setupId ),
+                                                   setupName, SETUP_CAPACITY );
+
+    // add to index
+    dictionaryPtr->indexTable[ slotIndex ] = (unsigned short)setupId;
+    dictionaryPtr->numSetups++;
+
+    pthread_mutex_unlock( &dictionaryPtr->dictionaryLock );
+
+    // return new id
+    return (unsigned short)setupId;
+}
+
+bool isDigit(char testChar)
+{
+    return testChar >= '0' && testChar <= '9';
+}
+
+bool isEmpty(AvlTreeNodeType* rootPtr)
+{
+    return rootPtr == NULL;
+}
+
+bool isIteratorDone(const TreeIteratorType* iteratorPtr)
+{
+    return iteratorPtr->stackTop == 0;
+}
+
+bool isSameString(const char* stringOne, const char* stringTwo)
+{
+    // initialize variables
+    int index = 0;
+
+    // loop while characters match and strings continue
+    while ( stringOne[ index ] == stringTwo[ index ] 
+                                           && stringOne[ index ] != NULL_CHAR )
+    {
+        index++;
+    }
+
+    // same only if both ended together
+    return stringOne[ index ] == stringTwo[ index ];
+}
+
+void loadLeftPath(TreeIteratorType* iteratorPtr, AvlTreeNodeType* wkgPtr)
+{
+    // loop down left children
+    while ( !isEmpty( wkgPtr ) )
+    {
+        iteratorPtr->stackPtrs[ iteratorPtr->stackTop ] = wkgPtr;
+        iteratorPtr->stackTop++;
+
+        wkgPtr = wkgPtr->leftChildPtr;
+    }
+}
+
+void mergeNodeArenas(NodeArenaType* destArenaPtr, NodeArenaType* srcArenaPtr)
+{
+    // initialize variables
+    NodeSlabType *slabPtr = srcArenaPtr->slabListPtr;
+    AvlTreeNodeType *nodePtr = srcArenaPtr->freeListPtr;
+
+    // check for slabs to move
+    if ( slabPtr != NULL )
+    {
+        // find last slab, link destination slabs after it
+        while ( slabPtr->nextSlabPtr != NULL )
+        {
+            slabPtr = slabPtr->nextSlabPtr;
+        }
+
+        slabPtr->nextSlabPtr = destArenaPtr->slabListPtr;
+        destArenaPtr->slabListPtr = srcArenaPtr->slabListPtr;
+    }
+
+    // check for released nodes to move
+    if ( nodePtr != NULL )
+    {
+        // find last released node, link destination list after it
+        while ( nodePtr->leftChildPtr != NULL )
+        {
+            nodePtr = nodePtr->leftChildPtr;
+        }
+
+        nodePtr->leftChildPtr = destArenaPtr->freeListPtr;
+        destArenaPtr->freeListPtr = srcArenaPtr->freeListPtr;
+    }
+
+    // release emptied arena, its strings are not kept
+    free( srcArenaPtr->stringHeapPtr );
+    free( srcArenaPtr );
+}
+
+int rangeQuery(AvlTreeNodeType* rootPtr, const char* lowRoomNumber,
+                    const char* highRoomNumber, RoomVisitFunction visitFunction,
+                                                              void* contextPtr)
+{
+    // initialize variables
+    RoomRangeType range;
+
+    // find ordering keys of bounds once
+    range.lowKey = createRoomKey( lowRoomNumber );
+    range.lowRoomNumber = lowRoomNumber;
+    range.highKey = createRoomKey( highRoomNumber );
+    range.highRoomNumber = highRoomNumber;
+    range.visitFunction = visitFunction;
+    range.contextPtr = contextPtr;
+
+    // return number of nodes visited
+    return visitRange( rootPtr, &range );
+}
+
+AvlTreeNodeType* rebalanceNode(AvlTreeNodeType* wkgPtr)
+{
+    // initialize variables
+    int balanceFactor;
+
+    // update stored height, then find balance factor
+    updateNodeHeight( wkgPtr );
+    balanceFactor = findBalanceFactor( wkgPtr );
+
+    // check for left side too tall
+    if ( balanceFactor > 1 )
+    {
+        // check for left right case
+        if ( findBalanceFactor( wkgPtr->leftChildPtr ) < 0 )
+        {
+            // rotate left child to the left, assign to left child
+            wkgPtr->leftChildPtr = rotateLeft( wkgPtr->leftChildPtr );
+        }
+
+        // rotate current to the right and return
+        return rotateRight( wkgPtr );
+    }
+    // check for right side too tall
+    else if ( balanceFactor < -1 )
+    {
+        // check for right left case
+        if ( findBalanceFactor( wkgPtr->rightChildPtr ) > 0 )
+        {
+            // rotate right child to the right, assign to right child
+            wkgPtr->rightChildPtr = rotateRight( wkgPtr->rightChildPtr );
+        }
+
+        // rotate current to the left and return
+        return rotateLeft( wkgPtr );
+    }
+
+    return wkgPtr;
+}
+
+void releaseArenaNode(AvlTreeNodeType* nodePtr)
+{
+    // initialize variables
+    NodeArenaType *arenaPtr = nodePtr->arenaPtr;
+
+    // link node to front of free list
+    nodePtr->leftChildPtr = arenaPtr->freeListPtr;
+    arenaPtr->freeListPtr = nodePtr;
+}
+
+void releaseNodeReference(AvlTreeNodeType* nodePtr)
+{
+    // check for empty subtree
+    if ( isEmpty( nodePtr ) )
+    {
+        return;
+    }
+
+    // drop one link to node
+    nodePtr->refCount--;
+
+    // check for no tree linking to node any longer
+    if ( nodePtr->refCount == 0 )
+    {
+        // drop its links to children, then return it to arena
+        releaseNodeReference( nodePtr->leftChildPtr );
+        releaseNodeReference( nodePtr->rightChildPtr );
+        releaseArenaNode( nodePtr );
+    }
+}
+
+AvlTreeNodeType* removeFromTree(AvlTreeNodeType* wkgPtr, 
+                          unsigned long long roomKey, const char* roomNumber)
+{
+    // initialize variables
+    AvlTreeNodeType *successorPtr, *childPtr;
+    int comparisonVal;
+
+    // check for room number not found
+    if ( isEmpty( wkgPtr ) )
+    {
+        return NULL;
+    }
+
+    // node on removal path is changed, copy it first if shared
+    wkgPtr = unshareNode( wkgPtr );
+
+    // find comparison value
+    comparisonVal = compareRoomKeys( wkgPtr->roomKey, wkgPtr->roomNumber, 
+                                                         roomKey, roomNumber );
+
+    // check for room number less than current
+    if ( comparisonVal > 0 )
+    {
+        // call left recursion, assign to left child pointer
+        wkgPtr->leftChildPtr = removeFromTree( wkgPtr->leftChildPtr, 
+                                                         roomKey, roomNumber );
+    }
+    // otherwise, check for room number greater than current
+    else if ( comparisonVal < 0 )
+    {
+        // call right recursion, assign to right child pointer
+        wkgPtr->rightChildPtr = removeFromTree( wkgPtr->rightChildPtr, 
+                                                         roomKey, roomNumber );
+    }
+    // otherwise, check for at most one child
+    else if ( isEmpty( wkgPtr->leftChildPtr ) 
+                                        || isEmpty( wkgPtr->rightChildPtr ) )
+    {
+        // child, if any, takes place of released node
+        childPtr = isEmpty( wkgPtr->leftChildPtr ) 
+                               ? wkgPtr->rightChildPtr : wkgPtr->leftChildPtr;
+        releaseArenaNode( wkgPtr );
+
+        LOG_TRACE( "- Removed %s", roomNumber );
+
+        return childPtr;
+    }
+    // otherwise, two children
+    else
+    {
+        LOG_TRACE( "- Removing %s, relinking successor", roomNumber );
+
+        // successor node is moved into place, no data is copied,
+        // so pointers to other nodes stay valid
+        childPtr = detachMinNode( wkgPtr->rightChildPtr, &successorPtr );
+
+        successorPtr->leftChildPtr = wkgPtr->leftChildPtr;
+        successorPtr->rightChildPtr = childPtr;
+
+        releaseArenaNode( wkgPtr );
+        wkgPtr = successorPtr;
+    }
+
+    // return subtree balanced on the way back up
+    return rebalanceNode( wkgPtr );
+}
+
+AvlTreeNodeType* removeNode(AvlTreeNodeType* rootPtr, const char* roomNumber)
+{
+    // initialize variables
+    NodeArenaType *arenaPtr;
+
+    // check for empty tree
+    if ( isEmpty( rootPtr ) )
+    {
+        return NULL;
+    }
+
+    arenaPtr = rootPtr->arenaPtr;
+
+    // check for room not in tree shared with copies
+    if ( arenaPtr->numVersions > 1 && search( rootPtr, roomNumber ) == NULL )
+    {
+        // return tree unchanged, no path is copied
+        return rootPtr;
+    }
+
+    // remove with ordering key found once
+    rootPtr = removeFromTree( rootPtr, createRoomKey( roomNumber ), 
+                                                                 roomNumber );
+
+    // check for last node removed
+    if ( isEmpty( rootPtr ) )
+    {
+        // check for last tree using arena
+        if ( arenaPtr->numVersions == 1 )
+        {
+            // release arena of now empty tree
+            clearNodeArena( arenaPtr );
+        }
+        // otherwise, copies still use arena
+        else
+        {
+            arenaPtr->numVersions--;
+        }
+    }
+
+    // return new root
+    return rootPtr;
+}
+
+void resizeClassSetupIndex(ClassSetupDictionaryType* dictionaryPtr)
+{
+    // initialize variables
+    unsigned short *newTable;
+    int newCapacity, mask, setupId, slotIndex;
+
+    // double capacity, starting from initial capacity
+    newCapacity = findMax( 2 * dictionaryPtr->indexCapacity, 
+                                                INITIAL_SETUP_INDEX_CAPACITY );
+    mask = newCapacity - 1;
+
+    // create empty table
+    newTable = (unsigned short *)malloc( 
+                                     newCapacity * sizeof(unsigned short) );
+
+    for ( slotIndex = 0; slotIndex < newCapacity; slotIndex++ )
+    {
+        newTable[ slotIndex ] = EMPTY_CLASS_SETUP_ID;
+    }
+
+    // re-insert every stored setup, id zero is never stored
+    for ( setupId = 1; setupId < dictionaryPtr->numSetups; setupId++ )
+    {
+        slotIndex = (int)( findStringHash( 
+                                findClassSetupName( dictionaryPtr, setupId ) )
+                                                        & (unsigned int)mask );
+
+        while ( newTable[ slotIndex ] != EMPTY_CLASS_SETUP_ID )
+        {
+            slotIndex = ( slotIndex + 1 ) & mask;
+        }
+
+        newTable[ slotIndex ] = (unsigned short)setupId;
+    }
+
+    // replace old table
+    free( dictionaryPtr->indexTable );
+    dictionaryPtr->indexTable = newTable;
+    dictionaryPtr->indexCapacity = newCapacity;
+}
+
+AvlTreeNodeType* rotateLeft(AvlTreeNodeType* oldParentPtr)
+{
+    // initialize variables
+    AvlTreeNodeType *tempPtr;
+
+    // log rotation
+    LOG_TRACE( "- Rotating Left" );
+
+    // both nodes are changed, copy them first if shared
+    oldParentPtr = unshareNode( oldParentPtr );
+    oldParentPtr->rightChildPtr = unshareNode( oldParentPtr->rightChildPtr );
+
+    // set temp pointer to right child
+    tempPtr = oldParentPtr->rightChildPtr;
+
+    // move left child of right child over to old parent
+    oldParentPtr->rightChildPtr = tempPtr->leftChildPtr;
+
+    // set left child of right child to old parent
+    tempPtr->leftChildPtr = oldParentPtr;
+
+    // update heights, lower node first
+    updateNodeHeight( oldParentPtr );
+    updateNodeHeight( tempPtr );
+
+    // return rotated tree
+    return tempPtr;
+}
+
+AvlTreeNodeType* rotateRight(AvlTreeNodeType* oldParentPtr)
+{
+    // initialize variables
+    AvlTreeNodeType *tempPtr;
+
+    // log rotation
+    LOG_TRACE( "- Rotating Right" );
+
+    // both nodes are changed, copy them first if shared
+    oldParentPtr = unshareNode( oldParentPtr );
+    oldParentPtr->leftChildPtr = unshareNode( oldParentPtr->leftChildPtr );
+
+    // set temp pointer to left child
+    tempPtr = oldParentPtr->leftChildPtr;
+
+    // move right child of left child over to old parent
+    oldParentPtr->leftChildPtr = tempPtr->rightChildPtr;
+
+    // set right child of left child to old parent
+    tempPtr->rightChildPtr = oldParentPtr;
+
+    // update heights, lower node first
+    updateNodeHeight( oldParentPtr );
+    updateNodeHeight( tempPtr );
+
+    // return rotated tree
+    return tempPtr;
+}
+
+AvlTreeNodeType* search(AvlTreeNodeType* wkgPtr, const char* roomNumber)
+{
+    // initialize variables
+    unsigned long long roomKey = createRoomKey( roomNumber );
+    int comparisonVal;
+
+    // loop until found or fall out of tree
+    while ( !isEmpty( wkgPtr ) )
+    {
+        // find comparison value
+        comparisonVal = compareRoomKeys( roomKey, roomNumber, 
+                                         wkgPtr->roomKey, wkgPtr->roomNumber );
+
+        // check for found
+        if ( comparisonVal == 0 )
+        {
+            // return found node
+            return wkgPtr;
+        }
+
+        // move right if search data is greater, otherwise left
+        wkgPtr = comparisonVal > 0 ? wkgPtr->rightChildPtr 
+                                   : wkgPtr->leftChildPtr;
+    }
+
+    // return not found
+    return NULL;
+}
+
+int searchMany(AvlTreeNodeType* rootPtr, const char** roomNumbers,
+                                  int numKeys, AvlTreeNodeType** foundPtrs)
+{
+    // initialize variables
+    AvlTreeNodeType *wkgPtrs[ SEARCH_BATCH_WIDTH ], *nodePtr;
+    unsigned long long roomKeys[ SEARCH_BATCH_WIDTH ];
+    int batchStart, batchCount, laneIndex, activeCount, comparisonVal;
+    int foundCount = 0;
+
+    // loop across keys one batch at a time
+    for ( batchStart = 0; batchStart < numKeys; 
+                                             batchStart += SEARCH_BATCH_WIDTH )
+    {
+        // start every key of batch at root, find ordering keys once
+        batchCount = findMin( SEARCH_BATCH_WIDTH, numKeys - batchStart );
+        activeCount = 0;
+
+        for ( laneIndex = 0; laneIndex < batchCount; laneIndex++ )
+        {
+            roomKeys[ laneIndex ] = createRoomKey( 
+                                       roomNumbers[ batchStart + laneIndex ] );
+            wkgPtrs[ laneIndex ] = rootPtr;
+            foundPtrs[ batchStart + laneIndex ] = NULL;
+        }
+
+        if ( !isEmpty( rootPtr ) )
+        {
+            activeCount = batchCount;
+        }
+
+        // move every unfinished key down one level per round
+        while ( activeCount > 0 )
+        {
+            activeCount = 0;
+
+            for ( laneIndex = 0; laneIndex < batchCount; laneIndex++ )
+            {
+                nodePtr = wkgPtrs[ laneIndex ];
+
+                // skip finished keys
+                if ( isEmpty( nodePtr ) )
+                {
+                    continue;
+                }
+
+                // find comparison value
+                comparisonVal = compareRoomKeys( roomKeys[ laneIndex ], 
+                                       roomNumbers[ batchStart + laneIndex ],
+                                       nodePtr->roomKey, nodePtr->roomNumber );
+
+                // check for found
+                if ( comparisonVal == 0 )
+                {
+                    foundPtrs[ batchStart + laneIndex ] = nodePtr;
+                    wkgPtrs[ laneIndex ] = NULL;
+                    foundCount++;
+                }
+                // otherwise, step to child and request it early
+                else
+                {
+                    nodePtr = comparisonVal > 0 ? nodePtr->rightChildPtr 
+                                                : nodePtr->leftChildPtr;
+                    wkgPtrs[ laneIndex ] = nodePtr;
+
+                    if ( !isEmpty( nodePtr ) )
+                    {
+                        PREFETCH_READ( nodePtr );
+                        activeCount++;
+                    }
+                }
+            }
+        }
+    }
+
+    // return number found
+    return foundCount;
+}
+
+void sortRecordArray(RoomRecordType** orderedPtrs, int numRecords)
+{
+    // initialize variables
+    RoomRecordType **tempPtrs, **srcPtrs, **destPtrs, **swapPtrs;
+    int width, lowIndex, midIndex, highIndex, leftIndex, rightIndex, index;
+
+    // create work array
+    tempPtrs = (RoomRecordType **)malloc(
+                                        numRecords * sizeof(RoomRecordType *));
+    srcPtrs = orderedPtrs;
+    destPtrs = tempPtrs;
+
+    // merge runs of doubling width, bottom up
+    for ( width = 1; width < numRecords; width *= 2 )
+    {
+        for ( lowIndex = 0; lowIndex < numRecords; lowIndex += 2 * width )
+        {
+            // find run boundaries
+            midIndex = findMin( lowIndex + width, numRecords );
+            highIndex = findMin( lowIndex + 2 * width, numRecords );
+            leftIndex = lowIndex;
+            rightIndex = midIndex;
+
+            // merge, taking left on ties to keep sort stable
+            for ( index = lowIndex; index < highIndex; index++ )
+            {
+                if ( rightIndex >= highIndex || ( leftIndex < midIndex
+                     && compareRecordKeys( srcPtrs[ leftIndex ],
+                                               srcPtrs[ rightIndex ] ) <= 0 ) )
+                {
+                    destPtrs[ index ] = srcPtrs[ leftIndex ];
+                    leftIndex++;
+                }
+                else
+                {
+                    destPtrs[ index ] = srcPtrs[ rightIndex ];
+                    rightIndex++;
+                }
+            }
+        }
+
+        // swap source and destination
+        swapPtrs = srcPtrs;
+        srcPtrs = destPtrs;
+        destPtrs = swapPtrs;
+    }
+
+    // check for result left in work array
+    if ( srcPtrs != orderedPtrs )
+    {
+        for ( index = 0; index < numRecords; index++ )
+        {
+            orderedPtrs[ index ] = srcPtrs[ index ];
+        }
+    }
+
+    // release work array
+    free( tempPtrs );
+}
+
+unsigned int storeArenaString(NodeArenaType* arenaPtr, const char* text,
+                                                int capacity, int* lengthPtr)
+{
+    // initialize variables
+    unsigned int offset = arenaPtr->heapUsed, sourceOffset = 0;
+    bool isInHeap = arenaPtr->stringHeapPtr != NULL 
+                     && text >= arenaPtr->stringHeapPtr 
+                     && text < arenaPtr->stringHeapPtr + arenaPtr->heapUsed;
+
+    // text from this heap is found again by offset after heap grows
+    if ( isInHeap )
+    {
+        sourceOffset = (unsigned int)( text - arenaPtr->stringHeapPtr );
+    }
+
+    // grow heap until longest allowed string fits
+    if ( arenaPtr->heapUsed + capacity > arenaPtr->heapCapacity )
+    {
+        if ( arenaPtr->heapCapacity == 0 )
+        {
+            arenaPtr->heapCapacity = INITIAL_STRING_HEAP_CAPACITY;
+        }
+
+        while ( arenaPtr->heapUsed + capacity > arenaPtr->heapCapacity )
+        {
+            arenaPtr->heapCapacity *= 2;
+        }
+
+        arenaPtr->stringHeapPtr = (char *)realloc( arenaPtr->stringHeapPtr,
+                                                     arenaPtr->heapCapacity );
+    }
+
+    if ( isInHeap )
+    {
+        text = arenaPtr->stringHeapPtr + sourceOffset;
+    }
+
+    // copy text with terminator, keep only space used
+    *lengthPtr = copyStringWithLimit( arenaPtr->stringHeapPtr + offset, 
+                                                              text, capacity );
+    arenaPtr->heapUsed += *lengthPtr + 1;
+
+    // return offset of stored text
+    return offset;
+}
+
+AvlTreeNodeType* unshareNode(AvlTreeNodeType* nodePtr)
+{
+    // initialize variables
+    AvlTreeNodeType *newNode;
+
+    // check for node linked only from caller
+    if ( nodePtr->refCount == 1 )
+    {
+        // change in place
+        return nodePtr;
+    }
+
+    // copy node in same arena, text stays where it is in string heap
+    newNode = allocateArenaNode( nodePtr->arenaPtr );
+    *newNode = *nodePtr;
+    newNode->refCount = 1;
+
+    // children are now linked from both nodes
+    if ( !isEmpty( newNode->leftChildPtr ) )
+    {
+        newNode->leftChildPtr->refCount++;
+    }
+
+    if ( !isEmpty( newNode->rightChildPtr ) )
+    {
+        newNode->rightChildPtr->refCount++;
+    }
+
+    // caller now links to copy instead of original
+    nodePtr->refCount--;
+
+    // return copy
+    return newNode;
+}
+
+AvlTreeNodeType* updateInTree(AvlTreeNodeType* wkgPtr, 
+    unsigned long long roomKey, const char* rmNmbr, 
+                    const char* bldgRm, const char* clsSetup, int capacity)
+{
+    // initialize variables
+    int comparisonVal;
+
+    // check for room number not found
+    if ( isEmpty( wkgPtr ) )
+    {
+        return NULL;
+    }
+
+    // node on update path is changed, copy it first if shared
+    wkgPtr = unshareNode( wkgPtr );
+
+    // find comparison value
+    comparisonVal = compareRoomKeys( wkgPtr->roomKey, wkgPtr->roomNumber, 
+                                                             roomKey, rmNmbr );
+
+    // check for room number less than current
+    if ( comparisonVal > 0 )
+    {
+        // call left recursion, assign to left child pointer
+        wkgPtr->leftChildPtr = updateInTree( wkgPtr->leftChildPtr, 
+                                roomKey, rmNmbr, bldgRm, clsSetup, capacity );
+    }
+    // otherwise, check for room number greater than current
+    else if ( comparisonVal < 0 )
+    {
+        // call right recursion, assign to right child pointer
+        wkgPtr->rightChildPtr = updateInTree( wkgPtr->rightChildPtr, 
+                                roomKey, rmNmbr, bldgRm, clsSetup, capacity );
+    }
+    // otherwise, room found
+    else
+    {
+        updateNodeData( wkgPtr, bldgRm, clsSetup, capacity );
+    }
+
+    // shape is unchanged, no balancing needed
+    return wkgPtr;
+}
+
+void updateNodeData(AvlTreeNodeType* nodePtr, 
+                    const char* buildingRm, const char* clsSetup, int capacity)
+{
+    // initialize variables
+    int buildingRoomLength;
+
+    // set capacity and class setup id
+    nodePtr->roomCapacity = capacity;
+    nodePtr->classSetupId = internClassSetup( clsSetup );
+
+    // check for changed building/room text
+    if ( !isSameString( accessBuildingRoom( nodePtr ), buildingRm ) )
+    {
+        // store new text in arena, old text stays until tree is cleared
+        nodePtr->buildingRoomOffset = storeArenaString( nodePtr->arenaPtr, 
+                      buildingRm, BUILDING_ROOM_CAPACITY, &buildingRoomLength );
+        nodePtr->buildingRoomLength = (unsigned char)buildingRoomLength;
+    }
+}
+
+void updateNodeHeight(AvlTreeNodeType* wkgPtr)
+{
+    // height is one more than the taller subtree
+    wkgPtr->height = findMax( findTreeHeight( wkgPtr->leftChildPtr ),
+                                findTreeHeight( wkgPtr->rightChildPtr ) ) + 1;
+}
+
+AvlTreeNodeType* upsert(AvlTreeNodeType* wkgPtr,
+    char* rmNmbr, char* bldgRm, char* clsSetup, int capacity)
+{
+    // initialize variables
+    AvlTreeNodeType *foundPtr = search( wkgPtr, rmNmbr );
+
+    // check for room already in tree
+    if ( foundPtr != NULL )
+    {
+        // check for tree shared with copies
+        if ( wkgPtr->arenaPtr->numVersions > 1 )
+        {
+            // copy path to room so copies keep old data
+            return updateInTree( wkgPtr, foundPtr->roomKey, rmNmbr, 
+                                              bldgRm, clsSetup, capacity );
+        }
+
+        // update in place, tree shape does not change
+        updateNodeData( foundPtr, bldgRm, clsSetup, capacity );
+
+        return wkgPtr;
+    }
+
+    // otherwise, insert new room, return new root
+    return insert( wkgPtr, rmNmbr, bldgRm, clsSetup, capacity );
+}
+
+int visitInOrder(AvlTreeNodeType* rootPtr, RoomVisitFunction visitFunction,
+                                                              void* contextPtr)
+{
+    // initialize variables
+    TreeIteratorType iterator;
+    AvlTreeNodeType *nodePtr;
+    int visitCount = 0;
+
+    // loop across nodes in order
+    initializeTreeIterator( &iterator, rootPtr );
+
+    while ( ( nodePtr = getNextTreeNode( &iterator ) ) != NULL )
+    {
+        visitFunction( nodePtr, contextPtr );
+        visitCount++;
+    }
+
+    // return number visited
+    return visitCount;
+}
+
+int visitRange(AvlTreeNodeType* wkgPtr, const RoomRangeType* rangePtr)
+{
+    // initialize variables
+    int visitCount = 0, lowComparison, highComparison;
+
+    // check for empty subtree
+    if ( isEmpty( wkgPtr ) )
+    {
+        return 0;
+    }
+
+    // find where node falls against both bounds
+    lowComparison = compareRoomKeys( wkgPtr->roomKey, wkgPtr->roomNumber,
+                             rangePtr->lowKey, rangePtr->lowRoomNumber );
+    highComparison = compareRoomKeys( wkgPtr->roomKey, wkgPtr->roomNumber,
+                             rangePtr->highKey, rangePtr->highRoomNumber );
+
+    // smaller room numbers can be in range only if node is above low bound
+    if ( lowComparison > 0 )
+    {
+        visitCount += visitRange( wkgPtr->leftChildPtr, rangePtr );
+    }
+
+    // visit node if within bounds
+    if ( lowComparison >= 0 && highComparison <= 0 )
+    {
+        rangePtr->visitFunction( wkgPtr, rangePtr->contextPtr );
+        visitCount++;
+    }
+
+    // larger room numbers can be in range only if node is below high bound
+    if ( highComparison < 0 )
+    {
+        visitCount += visitRange( wkgPtr->rightChildPtr, rangePtr );
+    }
+
+    // return number visited
+    return visitCount;
+}
+
+int writeInOrderRoomNumbers(BufferedOutputWriterType* writerPtr, 
+                                                      AvlTreeNodeType* rootPtr)
+{
+    // initialize variables
+    TreeIteratorType iterator;
+    AvlTreeNodeType *nodePtr;
+    int writeCount = 0;
+
+    // loop across nodes in order
+    initializeTreeIterator( &iterator, rootPtr );
+
+    while ( ( nodePtr = getNextTreeNode( &iterator ) ) != NULL )
+    {
+        writeStringToBufferedWriter( writerPtr, nodePtr->roomNumber );
+        writeBytesToBufferedWriter( writerPtr, ", ", 2 );
+        writeCount++;
     }
-}
\ No newline at end of file
+
+    // return number written
+    return writeCount;
+}
+
+bool writeNodeDisplay(BufferedOutputWriterType* writerPtr, 
+                                                 const AvlTreeNodeType* nodePtr)
+{
+    // initialize variables
+    bool success;
+
+    // write labeled fields on one line
+    success = writeStringToBufferedWriter( writerPtr, "Room Number: " )
+           && writeStringToBufferedWriter( writerPtr, nodePtr->roomNumber )
+           && writeStringToBufferedWriter( writerPtr, ", Building/Room: " )
+           && writeStringToBufferedWriter( writerPtr, 
+                                                accessBuildingRoom( nodePtr ) )
+           && writeStringToBufferedWriter( writerPtr, ", Class Setup: " )
+           && writeStringToBufferedWriter( writerPtr, 
+                                                  accessClassSetup( nodePtr ) )
+           && writeStringToBufferedWriter( writerPtr, ", Room Capacity: " )
+           && writeIntegerToBufferedWriter( writerPtr, nodePtr->roomCapacity )
+           && writeCharacterToBufferedWriter( writerPtr, NEWLINE_CHAR );
+
+    // return result of operation
+    return success;
+}
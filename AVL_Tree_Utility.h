@@ -5,43 +5,342 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdbool.h>
+#include <pthread.h>
 #include "StandardConstants.h"
+#include "File_Output_Utility.h"
+#include "Logging_Utility.h"
 
 // Constants
 
 typedef enum { ROOM_NUM_CAPACITY = 10, SETUP_CAPACITY = 42, 
                                        BUILDING_ROOM_CAPACITY = 72 } Capacities;
 
+typedef enum { INITIAL_SLAB_CAPACITY = 32, 
+                                     MAX_SLAB_CAPACITY = 65536 } SlabCapacities;
+
+typedef enum { INITIAL_STRING_HEAP_CAPACITY = 1024 } StringHeapCapacities;
+
+typedef enum { SETUP_PAGE_SIZE = 256, SETUP_PAGE_COUNT = 256,
+               MAX_CLASS_SETUPS = SETUP_PAGE_SIZE * SETUP_PAGE_COUNT,
+               INITIAL_SETUP_INDEX_CAPACITY = 64,
+               EMPTY_CLASS_SETUP_ID = 0 } ClassSetupCapacities;
+
+typedef enum { MAX_KEY_BUILDING_DIGITS = 3, 
+                                      MAX_KEY_ROOM_DIGITS = 6 } RoomKeyDigits;
+
+typedef enum { ROOM_KEY_VALID_SHIFT = 63, ROOM_KEY_BUILDING_LEN_SHIFT = 61,
+               ROOM_KEY_BUILDING_SHIFT = 51, ROOM_KEY_LETTER_SHIFT = 43,
+               ROOM_KEY_ROOM_LEN_SHIFT = 40, 
+                                     ROOM_KEY_ROOM_SHIFT = 20 } RoomKeyShifts;
+
+typedef enum { SEARCH_BATCH_WIDTH = 8 } SearchBatchWidths;
+
+// AVL height stays under 1.45 log2 n, so 64 levels exceeds any real tree
+typedef enum { MAX_ITERATOR_DEPTH = 64 } IteratorCapacities;
+
+// trees lower than minimum height have under 16,384 nodes
+// and are copied on one thread
+typedef enum { PARALLEL_COPY_MIN_HEIGHT = 14, 
+                               COPY_TASKS_PER_THREAD = 4 } ParallelCopyLimits;
+
+// room key value for room numbers that cannot be packed
+#define NO_ROOM_KEY 0ULL
+
+// hint to bring memory into cache ahead of use
+#if defined( __GNUC__ )
+#define PREFETCH_READ( addressPtr ) __builtin_prefetch( ( addressPtr ), 0, 3 )
+#else
+#define PREFETCH_READ( addressPtr )
+#endif
+
 // Data Structures
 
-typedef struct AvlTreeNodeStruct
+struct NodeArenaStruct;
+
+// one input row, fixed width so files can be read straight into it
+typedef struct RoomRecordStruct
    {
     char roomNumber[ ROOM_NUM_CAPACITY ];
 
+    unsigned long long roomKey;
+
     char buildingRoom[ BUILDING_ROOM_CAPACITY ];
 
     char classSetup[ SETUP_CAPACITY ];
 
     int roomCapacity;
+   } RoomRecordType;
+
+// building/room text lives in string heap of owning arena,
+// class setup is an id in the shared class setup dictionary;
+// copies of a tree share nodes, refCount counts links to node 
+// from parent nodes and tree roots, node with more than one is
+// copied before it is changed
+typedef struct AvlTreeNodeStruct
+   {
+    unsigned long long roomKey;
+
+    char roomNumber[ ROOM_NUM_CAPACITY ];
+
+    unsigned short classSetupId;
+
+    int roomCapacity;
+
+    unsigned int buildingRoomOffset;
+
+    unsigned char buildingRoomLength;
+
+    int height;
+
+    int refCount;
+
+    struct NodeArenaStruct *arenaPtr;
 
     struct AvlTreeNodeStruct *leftChildPtr, *rightChildPtr;
    } AvlTreeNodeType;
 
+typedef struct NodeSlabStruct
+   {
+    struct NodeSlabStruct *nextSlabPtr;
+
+    int capacity, usedCount;
+
+    AvlTreeNodeType nodes[];
+   } NodeSlabType;
+
+// shared by a tree and all its copies, numVersions counts those trees
+typedef struct NodeArenaStruct
+   {
+    NodeSlabType *slabListPtr;
+
+    AvlTreeNodeType *freeListPtr;
+
+    int nextSlabCapacity;
+
+    char *stringHeapPtr;
+
+    unsigned int heapUsed, heapCapacity;
+
+    int numVersions;
+   } NodeArenaType;
+
+typedef char ClassSetupPageType[ SETUP_PAGE_SIZE ][ SETUP_CAPACITY ];
+
+// pages never move once created, so names can be read without the lock
+typedef struct ClassSetupDictionaryStruct
+   {
+    ClassSetupPageType *pagePtrs[ SETUP_PAGE_COUNT ];
+
+    int numSetups;
+
+    unsigned short *indexTable;
+
+    int indexCapacity;
+
+    pthread_mutex_t dictionaryLock;
+   } ClassSetupDictionaryType;
+
+// called once for each node of a range query, in room number order
+typedef void ( *RoomVisitFunction )( AvlTreeNodeType *nodePtr, 
+                                                           void *contextPtr );
+
+// inclusive room number bounds with their ordering keys found once
+typedef struct RoomRangeStruct
+   {
+    unsigned long long lowKey, highKey;
+
+    const char *lowRoomNumber, *highRoomNumber;
+
+    RoomVisitFunction visitFunction;
+
+    void *contextPtr;
+   } RoomRangeType;
+
+// nodes whose left subtree is done but which are not yet returned,
+// deepest on top
+typedef struct TreeIteratorStruct
+   {
+    AvlTreeNodeType *stackPtrs[ MAX_ITERATOR_DEPTH ];
+
+    int stackTop;
+   } TreeIteratorType;
+
+// one subtree of a parallel copy, copied by a worker into slabs of
+// its own arena, root of copy is stored through link in copied top levels
+typedef struct TreeCopyTaskStruct
+   {
+    AvlTreeNodeType *sourcePtr;
+
+    AvlTreeNodeType **destPtrPtr;
+
+    NodeArenaType *slabArenaPtr;
+   } TreeCopyTaskType;
+
+typedef struct TreeCopyQueueStruct
+   {
+    TreeCopyTaskType *taskArray;
+
+    NodeArenaType *arenaPtr;
+
+    int numTasks, nextTaskIndex;
+
+    pthread_mutex_t queueLock;
+   } TreeCopyQueueType;
+
 // Prototypes
 
+/*
+Name: accessBuildingRoom
+Process: finds building/room text of node in string heap of its arena,
+         text may move when more strings are added to same arena
+Function input/parameters: node (const AvlTreeNodeType *)
+Function output/parameters: none
+Function output/returned: building/room text (const char *)
+Device input/---: none
+Device output/---: none
+Dependencies: none
+*/
+const char *accessBuildingRoom( const AvlTreeNodeType *nodePtr );
+
+/*
+Name: accessClassSetup
+Process: finds class setup name of node in shared class setup dictionary
+Function input/parameters: node (const AvlTreeNodeType *)
+Function output/parameters: none
+Function output/returned: class setup name (const char *)
+Device input/---: none
+Device output/---: none
+Dependencies: accessClassSetupDictionary, findClassSetupName
+*/
+const char *accessClassSetup( const AvlTreeNodeType *nodePtr );
+
+/*
+Name: accessClassSetupDictionary
+Process: provides class setup dictionary shared by all trees,
+         lives until program ends
+Function input/parameters: none
+Function output/parameters: none
+Function output/returned: pointer to dictionary (ClassSetupDictionaryType *)
+Device input/---: none
+Device output/---: none
+Dependencies: none
+*/
+ClassSetupDictionaryType *accessClassSetupDictionary();
+
+/*
+Name: allocateArenaNode
+Process: provides storage for one node from arena,
+         reuses released node if available, otherwise takes next node
+         from current slab, adding new slab (double size of last,
+         up to MAX_SLAB_CAPACITY) when current slab is full
+Function input/parameters: node arena (NodeArenaType *)
+Function output/parameters: none
+Function output/returned: pointer to node, uninitialized except for
+                          reference count of one (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: malloc, sizeof, findMin
+*/
+AvlTreeNodeType *allocateArenaNode( NodeArenaType *arenaPtr );
+
+/*
+Name: buildTreeFromRecordArray
+Process: bulk loads a balanced tree from an array of data records,
+         records are put in order with duplicates dropped as insert does,
+         then tree is built in linear time with no rotations;
+         records are copied, array is not changed
+Function input/parameters: array of records (RoomRecordType *),
+                           number of records (int)
+Function output/parameters: none
+Function output/returned: root of new tree or NULL if no records
+                          (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: createSortedRecordPointers, createNodeArena, 
+              buildTreeFromSortedArray, free
+*/
+AvlTreeNodeType *buildTreeFromRecordArray( RoomRecordType *recordArray, 
+                                                              int numRecords );
+
+/*
+Name: buildTreeFromSortedArray
+Process: recursively builds perfectly balanced tree from sorted,
+         duplicate free record pointers, middle record becomes root,
+         nodes are created in given arena
+Function input/parameters: node arena (NodeArenaType *),
+                           sorted record pointers (RoomRecordType **),
+                           low and high indices of range (int)
+Function output/parameters: none
+Function output/returned: root of new subtree or NULL if range empty
+                          (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: createTreeNodeInArena, 
+              buildTreeFromSortedArray (recursively), updateNodeHeight
+*/
+AvlTreeNodeType *buildTreeFromSortedArray( NodeArenaType *arenaPtr,
+                                           RoomRecordType **orderedPtrs, 
+                                                 int lowIndex, int highIndex );
+
+/*
+Name: clearNodeArena
+Process: returns all slabs, string heap, and arena itself to OS,
+         every node allocated from arena is released at once
+Function input/parameters: node arena (NodeArenaType *)
+Function output/parameters: none
+Function output/returned: NULL
+Device input/---: none
+Device output/---: none
+Dependencies: free
+*/
+NodeArenaType *clearNodeArena( NodeArenaType *arenaPtr );
+
 /*
 Name: clearTree
-Process: recursively removes all nodes from tree and returns memory to OS,
-         uses post order traversal strategy
+Process: removes all nodes from tree and returns memory to OS
+         by releasing the node arena owned by the tree,
+         must be called with the tree root; while copies made by
+         copyTree remain, only nodes no copy links to are released
 Function input/parameters: pointer to root/ working pointer (AvlTreeNodType *)
 Function output/parameters: none
 Function output/returned: NULL
 Device input/---: none
 Device output/---: none
-Dependencies: free
+Dependencies: isEmpty, clearNodeArena, releaseNodeReference
 */
 AvlTreeNodeType *clearTree( AvlTreeNodeType *wkgPtr );
 
+/*
+Name: compareRecordKeys
+Process: compares room numbers of two records using their ordering keys,
+         result is as specified for compareRoomNumbers
+Function input/parameters: two records to be compared (const RoomRecordType *)
+Function output/parameters: none
+Function output/returned: result as specified for compareRoomNumbers (int)
+Device input/---: none
+Device output/---: none
+Dependencies: compareRoomKeys
+*/
+int compareRecordKeys( const RoomRecordType *recordOne, 
+                                             const RoomRecordType *recordTwo );
+
+/*
+Name: compareRoomKeys
+Process: compares two room numbers with single integer comparison
+         when both have packed ordering keys,
+         otherwise falls back to compareRoomNumbers on the strings,
+         result is as specified for compareRoomNumbers
+Function input/parameters: ordering key (unsigned long long) 
+                           and room number (const char *) of each side
+Function output/parameters: none
+Function output/returned: result as specified for compareRoomNumbers (int)
+Device input/---: none
+Device output/---: none
+Dependencies: compareRoomNumbers
+*/
+int compareRoomKeys( unsigned long long keyOne, const char *roomNbrOne,
+                           unsigned long long keyTwo, const char *roomNbrTwo );
+
 /*
 Name: compareRoomNumbers
 Process: compares room numbers as follows:
@@ -49,6 +348,7 @@ Process: compares room numbers as follows:
          returns value greater than zero (not necessarily 1)
          - if left room number is less than the right room number, 
          returns value less than zero (not necessarily -1)
+         - runs of digits are compared as numbers, longer run is greater
          - if room numbers are equal but one is longer, longer one is greater
          - otherwise, returns zero
 Function input/parameters: two room numbers (as strings)
@@ -61,6 +361,21 @@ Dependencies: isDigit
 */
 int compareRoomNumbers( const char *roomNbrOne, const char *roomNbrTwo );
 
+/*
+Name: copyArenaStrings
+Process: copies whole string heap of source arena into empty arena,
+         text keeps its offsets, so copied nodes use them unchanged
+Function input/parameters: empty arena (NodeArenaType *),
+                           source arena (const NodeArenaType *)
+Function output/parameters: arena with copied text (NodeArenaType *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: malloc
+*/
+void copyArenaStrings( NodeArenaType *destArenaPtr, 
+                                        const NodeArenaType *srcArenaPtr );
+
 /*
 Name: copyString
 Process: copies string from source to destination
@@ -73,26 +388,200 @@ Dependencies: none
 */
 void copyString( char *dest, const char *source );
 
+/*
+Name: copyStringWithLimit
+Process: copies string from source to destination, 
+         stops before capacity is reached so result is always terminated
+Function input/parameters: source string (const char *), 
+                           destination capacity (int)
+Function output/parameters: destination string (char *)
+Function output/returned: number of characters copied (int)
+Device input/---: none
+Device output/---: none
+Dependencies: none
+*/
+int copyStringWithLimit( char *dest, const char *source, int capacity );
+
 /*
 Name: copyTree
-Process: creates duplicate copy of given tree, allocates all new nodes,
-         returns pointer to root of new tree or NULL if original tree was empty,
-         uses pre order traversal strategy
+Process: creates copy of given tree in constant time, copy shares all
+         nodes and arena with original; insert, upsert and removeNode on
+         either tree copy only the nodes on the path they change, so
+         other tree is not affected; trees sharing an arena must not be
+         changed from more than one thread at a time,
+         returns pointer to root of new tree or NULL if original tree was empty
 Function input/parameters: tree root/working pointer (AvlTreeNodeType *)
 Function output/parameters: none
 Function output/returned: tree root of copied tree
                           or NULL as specified (AvlTreeNodeType *)
 Device input/---: none
 Device output/---: none
-Dependencies: variable options
+Dependencies: isEmpty
 */
 AvlTreeNodeType *copyTree( AvlTreeNodeType *rootPtr );
 
+/*
+Name: copyTreeDeep
+Process: creates duplicate copy of given tree, allocates all new nodes
+         in a new arena owned by the copy, so it shares nothing with
+         original; string heap is copied whole, including text no
+         longer used, returns pointer to root of new tree or NULL if 
+         original tree was empty
+Function input/parameters: tree root/working pointer (AvlTreeNodeType *)
+Function output/parameters: none
+Function output/returned: tree root of copied tree
+                          or NULL as specified (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: isEmpty, createNodeArena, copyArenaStrings, copyTreeIntoArena
+*/
+AvlTreeNodeType *copyTreeDeep( AvlTreeNodeType *rootPtr );
+
+/*
+Name: copyTreeIntoArena
+Process: recursively duplicates given subtree with new nodes taken
+         from slabs of one arena and owned by another, which holds
+         a copy of the source string heap, keeping shape and heights,
+         uses pre order traversal strategy
+Function input/parameters: arena nodes are taken from (NodeArenaType *),
+                           arena owning copy (NodeArenaType *),
+                           subtree root/working pointer (AvlTreeNodeType *)
+Function output/parameters: none
+Function output/returned: root of copied subtree or NULL if empty 
+                          (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: isEmpty, allocateArenaNode, copyTreeIntoArena (recursively)
+*/
+AvlTreeNodeType *copyTreeIntoArena( NodeArenaType *slabArenaPtr, 
+                          NodeArenaType *arenaPtr, AvlTreeNodeType *wkgPtr );
+
+/*
+Name: copyTreeParallel
+Process: creates duplicate copy of given tree as copyTreeDeep does,
+         with same shape; top levels are copied on calling thread,
+         subtrees below them are copied by up to given number of
+         threads, calling thread included, which copies them all if no
+         other thread starts; each goes into slabs of its own, and slabs
+         are then moved to arena of copy; trees lower than 
+         PARALLEL_COPY_MIN_HEIGHT are copied on calling thread
+Function input/parameters: tree root/working pointer (AvlTreeNodeType *),
+                           number of threads (int)
+Function output/parameters: none
+Function output/returned: tree root of copied tree
+                          or NULL if original was empty (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: isEmpty, copyTreeDeep, createNodeArena, copyArenaStrings,
+              malloc, sizeof, pthread_mutex_init, copyTreeTopLevels,
+              findMin, pthread_create, pthread_join, pthread_mutex_destroy,
+              copyTreeTasks, mergeNodeArenas, free
+*/
+AvlTreeNodeType *copyTreeParallel( AvlTreeNodeType *rootPtr, int numThreads );
+
+/*
+Name: copyTreeTasks
+Process: thread worker, repeatedly takes next subtree from queue and
+         copies it, until no subtrees remain
+Function input/parameters: copy queue (void *, TreeCopyQueueType *)
+Function output/parameters: subtrees copied, slab arenas set 
+                            (TreeCopyQueueType *)
+Function output/returned: NULL
+Device input/---: none
+Device output/---: none
+Dependencies: pthread_mutex_lock, pthread_mutex_unlock, createNodeArena,
+              copyTreeIntoArena
+*/
+void *copyTreeTasks( void *queuePtr );
+
+/*
+Name: copyTreeTopLevels
+Process: recursively copies nodes above given depth into arena of
+         copy, each subtree at that depth is added to queue as a task
+Function input/parameters: copy queue (TreeCopyQueueType *),
+                           subtree root/working pointer (AvlTreeNodeType *),
+                           link to set to copy (AvlTreeNodeType **),
+                           levels left to copy (int)
+Function output/parameters: tasks added (TreeCopyQueueType *),
+                            link to copy, set later for tasks 
+                            (AvlTreeNodeType **)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: isEmpty, allocateArenaNode, copyTreeTopLevels (recursively)
+*/
+void copyTreeTopLevels( TreeCopyQueueType *copyQueue, AvlTreeNodeType *wkgPtr,
+                                AvlTreeNodeType **destPtrPtr, int depth );
+
+/*
+Name: countTreeNodes
+Process: recursively counts nodes of subtree
+Function input/parameters: subtree root/working pointer (AvlTreeNodeType *)
+Function output/parameters: none
+Function output/returned: number of nodes (int)
+Device input/---: none
+Device output/---: none
+Dependencies: isEmpty, countTreeNodes (recursively)
+*/
+int countTreeNodes( AvlTreeNodeType *wkgPtr );
+
+/*
+Name: createNodeArena
+Process: dynamically creates empty node arena, no slabs or string heap 
+         are allocated until first node is requested
+Function input/parameters: none
+Function output/parameters: none
+Function output/returned: pointer to new arena (NodeArenaType *)
+Device input/---: none
+Device output/---: none
+Dependencies: malloc, sizeof
+*/
+NodeArenaType *createNodeArena();
+
+/*
+Name: createRoomKey
+Process: packs room number of shape DDD-DDD or DDD-LDDD 
+         (1 to 3 building digits, optional letter, 1 to 6 room digits)
+         into a 64 bit key whose integer order matches compareRoomNumbers,
+         fields from high bits down: valid flag, building digit count,
+         building number, letter, room digit count, room number
+Function input/parameters: room number (const char *)
+Function output/parameters: none
+Function output/returned: packed key, or NO_ROOM_KEY for other shapes
+                          (unsigned long long)
+Device input/---: none
+Device output/---: none
+Dependencies: isDigit
+*/
+unsigned long long createRoomKey( const char *roomNumber );
+
+/*
+Name: createSortedRecordPointers
+Process: sets ordering key of each record,
+         creates array of pointers to given records in room number order,
+         detects records already in forward or backward order
+         and otherwise stable sorts them using compareRecordKeys,
+         drops later duplicates as insert does;
+         records are not moved, caller frees returned array
+Function input/parameters: array of records (RoomRecordType *),
+                           number of records (int)
+Function output/parameters: number of unique records (int *)
+Function output/returned: sorted record pointers (RoomRecordType **)
+Device input/---: none
+Device output/---: none
+Dependencies: malloc, sizeof, createRoomKey, compareRecordKeys, 
+              sortRecordArray, findMin
+*/
+RoomRecordType **createSortedRecordPointers( RoomRecordType *recordArray, 
+                                        int numRecords, int *uniqueCountPtr );
+
 /*
 Name: createTreeNodeFromData
 Process: captures data from individual data items, 
-         dynamically creates new node,
-         copies data, sets child pointers to NULL,
+         creates new node in its own new arena,
+         copies data, building/room text into string heap of arena
+         and class setup as dictionary id, 
+         sets height to zero and child pointers to NULL,
          and returns pointer to new node         
 Function input/parameters: room number, building room, 
                            and class setup (const char *), capacity (int)
@@ -100,7 +589,7 @@ Function output/parameters: none
 Function output/returned: pointer to new node as specified (AvlTreeNodeType *)
 Device input/---: none
 Device output/---: none
-Dependencies: malloc, sizeof, copyString
+Dependencies: createNodeArena, createTreeNodeInArena
 */
 AvlTreeNodeType *createTreeNodeFromData( const char *rmNumber, 
                    const char *buildingRm, const char *clsSetup, int capacity );
@@ -120,15 +609,53 @@ Dependencies: variable options
 */
 AvlTreeNodeType *createTreeNodeFromNode( const AvlTreeNodeType sourceNode );
 
+/*
+Name: createTreeNodeInArena
+Process: captures data from individual data items, 
+         creates new node from given arena,
+         copies data, building/room text into string heap of arena
+         and class setup as dictionary id, 
+         sets height to zero and child pointers to NULL,
+         and returns pointer to new node         
+Function input/parameters: node arena (NodeArenaType *),
+                           room number, building room, 
+                           and class setup (const char *), capacity (int)
+Function output/parameters: none
+Function output/returned: pointer to new node as specified (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: allocateArenaNode, copyString, createRoomKey, 
+              storeArenaString, internClassSetup
+*/
+AvlTreeNodeType *createTreeNodeInArena( NodeArenaType *arenaPtr, 
+                                        const char *rmNumber, 
+                   const char *buildingRm, const char *clsSetup, int capacity );
+
+/*
+Name: detachMinNode
+Process: recursively takes smallest node out of subtree, shared nodes
+         on the path and detached node are copied first,
+         then follows recursion back up subtree to implement balancing
+Function input/parameters: pointer to subtree, not empty (AvlTreeNodeType *)
+Function output/parameters: detached node (AvlTreeNodeType **)
+Function output/returned: pointer to root of subtree without detached node
+Device input/---: none
+Device output/monitor: rotations logged at trace level
+Dependencies: unshareNode, isEmpty, detachMinNode (recursively), rebalanceNode
+*/
+AvlTreeNodeType *detachMinNode( AvlTreeNodeType *wkgPtr, 
+                                         AvlTreeNodeType **minNodePtrPtr );
+
 /*
 Name: displayChars
-Process: recursively displays a specified number of characters
+Process: displays a specified number of characters
 Function input/parameters: number of characters (int), output character (char)
 Function output/parameters: none
 Function output/returned: none
 Device input/---: none
 Device output/monitor: characters displayed as specified
-Dependencies: displayChars (recursively)
+Dependencies: accessDefaultOutputWriter, 
+              writeRepeatedCharacterToBufferedWriter, flushBufferedWriter
 */
 void displayChars( int numChars, char outChar );
 
@@ -145,6 +672,49 @@ Dependencies: variable options
 */
 int findBalanceFactor( AvlTreeNodeType *wkgPtr );
 
+/*
+Name: findCeiling
+Process: finds node with smallest room number not less than given one
+Function input/parameters: tree root (AvlTreeNodeType *), 
+                           room number (const char *)
+Function output/parameters: none
+Function output/returned: pointer to found node or NULL (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: findNeighborNode
+*/
+AvlTreeNodeType *findCeiling( AvlTreeNodeType *rootPtr, 
+                                                      const char *roomNumber );
+
+/*
+Name: findClassSetupName
+Process: finds stored name of class setup id by its page and slot,
+         id must be in use and not EMPTY_CLASS_SETUP_ID
+Function input/parameters: dictionary (ClassSetupDictionaryType *), 
+                           class setup id (int)
+Function output/parameters: none
+Function output/returned: stored name (char *)
+Device input/---: none
+Device output/---: none
+Dependencies: none
+*/
+char *findClassSetupName( ClassSetupDictionaryType *dictionaryPtr, 
+                                                                 int setupId );
+
+/*
+Name: findFloor
+Process: finds node with largest room number not greater than given one
+Function input/parameters: tree root (AvlTreeNodeType *), 
+                           room number (const char *)
+Function output/parameters: none
+Function output/returned: pointer to found node or NULL (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: findNeighborNode
+*/
+AvlTreeNodeType *findFloor( AvlTreeNodeType *rootPtr, 
+                                                      const char *roomNumber );
+
 /*
 Name: findMax
 Process: finds maximum between two values, returns larger
@@ -157,19 +727,104 @@ Dependencies: none
 */
 int findMax( int one, int other );
 
+/*
+Name: findMin
+Process: finds minimum between two values, returns smaller
+Function input/parameters: two values (int)
+Function output/parameters: none
+Function output/returned: smaller of two values (int)
+Device input/---: none
+Device output/---: none
+Dependencies: none
+*/
+int findMin( int one, int other );
+
+/*
+Name: findNeighborNode
+Process: walks one path from root keeping the last node passed 
+         on the wanted side of given room number,
+         equal node is returned at once when equal is allowed;
+         given room number need not be in tree
+Function input/parameters: tree root (AvlTreeNodeType *), 
+                           room number (const char *),
+                           flag to look above rather than below (bool),
+                           flag to accept equal room number (bool)
+Function output/parameters: none
+Function output/returned: pointer to found node or NULL (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: isEmpty, createRoomKey, compareRoomKeys
+*/
+AvlTreeNodeType *findNeighborNode( AvlTreeNodeType *rootPtr, 
+                   const char *roomNumber, bool aboveFlag, bool equalFlag );
+
+/*
+Name: findPredecessor
+Process: finds node with largest room number less than given one
+Function input/parameters: tree root (AvlTreeNodeType *), 
+                           room number (const char *)
+Function output/parameters: none
+Function output/returned: pointer to found node or NULL (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: findNeighborNode
+*/
+AvlTreeNodeType *findPredecessor( AvlTreeNodeType *rootPtr, 
+                                                      const char *roomNumber );
+
+/*
+Name: findStringHash
+Process: finds FNV-1a hash of string
+Function input/parameters: string (const char *)
+Function output/parameters: none
+Function output/returned: hash value (unsigned int)
+Device input/---: none
+Device output/---: none
+Dependencies: none
+*/
+unsigned int findStringHash( const char *text );
+
+/*
+Name: findSuccessor
+Process: finds node with smallest room number greater than given one
+Function input/parameters: tree root (AvlTreeNodeType *), 
+                           room number (const char *)
+Function output/parameters: none
+Function output/returned: pointer to found node or NULL (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: findNeighborNode
+*/
+AvlTreeNodeType *findSuccessor( AvlTreeNodeType *rootPtr, 
+                                                      const char *roomNumber );
+
 /*
 Name: findTreeHeight
-Process: recursively finds tree height from current node to bottom of tree
+Process: reports tree height from current node to bottom of tree,
+         uses height stored in node so runs in constant time
 Function input/parameters: pointer to current tree location (AvlTreeNodeType *)
 Function output/parameters: none
 Function output/returned: -1 if empty tree, 0 if no subtrees,
                           max height of subtrees otherwise
 Device input/---: none
 Device output/---: none
-Dependencies: variable options
+Dependencies: isEmpty
 */
 int findTreeHeight( AvlTreeNodeType *wkgPtr );
 
+/*
+Name: getNextTreeNode
+Process: returns next node in room number order and moves iterator past it,
+         loading left path of node's right subtree
+Function input/parameters: iterator (TreeIteratorType *)
+Function output/parameters: advanced iterator (TreeIteratorType *)
+Function output/returned: next node, or NULL when done (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: isIteratorDone, loadLeftPath
+*/
+AvlTreeNodeType *getNextTreeNode( TreeIteratorType *iteratorPtr );
+
 /*
 Name: initializeTree
 Process: returns NULL to set tree to empty
@@ -182,37 +837,95 @@ Dependencies: none
 */
 AvlTreeNodeType *initializeTree();
 
+/*
+Name: initializeTreeIterator
+Process: sets iterator to start of in order traversal of tree,
+         iterator uses no recursion and allocates nothing;
+         tree must not change while iterator is used
+Function input/parameters: iterator (TreeIteratorType *), 
+                           tree root (AvlTreeNodeType *)
+Function output/parameters: iterator at first node (TreeIteratorType *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: loadLeftPath
+*/
+void initializeTreeIterator( TreeIteratorType *iteratorPtr, 
+                                                    AvlTreeNodeType *rootPtr );
+
 /*
 Name: inOrderDisplay
-Process: recursively iterates across tree using in order strategy,
-         displays node values
+Process: displays room numbers of tree in order on one line,
+         through default output writer
 Function input/parameters: pointer to current tree location (AvlTreeNodeType *)
 Function output/parameters: none
 Function output/returned: none
 Device input/---: none
-Device output/---: none
-Dependencies: inOrderDisplay (recursively)
+Device output/monitor: room numbers displayed
+Dependencies: accessDefaultOutputWriter, writeInOrderRoomNumbers,
+              writeCharacterToBufferedWriter, flushBufferedWriter
 */
 void inOrderDisplay( AvlTreeNodeType *wkgPtr );
 
 /*
 Name: insert
-Process: recursively finds location to insert node, inserts node,
+Process: inserts node into tree, new node is created in the arena
+         owned by the tree, or in a new arena if the tree is empty,
+         does not allow duplicate entries; in tree shared with copies,
+         duplicate is found first so no path is copied for it
+Function input/parameters: pointer to tree root (AvlTreeNodeType *),
+                           room number, building room data, class setup (char *)
+Function output/parameters: none
+Function output/returned: pointer to root of tree
+Device input/---: none
+Device output/monitor: balancing cases logged at trace level
+Dependencies: isEmpty, createNodeArena, search, createRoomKey, insertInArena
+*/
+AvlTreeNodeType *insert( AvlTreeNodeType *wkgPtr, 
+                     char *rmNmbr, char *bldgRm, char *clsSetup, int capacity );
+
+/*
+Name: insertInArena
+Process: recursively finds location to insert node, inserts node
+         created from given arena, shared nodes on the path are copied,
          then follows recursion back up tree to implement balancing,
          does not allow duplicate entries
-Function input/parameters: pointer to current tree location (AvlTreeNodeType *),
+Function input/parameters: node arena (NodeArenaType *),
+                           pointer to current tree location (AvlTreeNodeType *),
+                           ordering key of room number (unsigned long long),
                            room number, building room data, class setup (char *)
 Function output/parameters: none
 Function output/returned: pointer to calling function/tree node above
                           where function is called
 Device input/---: none
-Device output/monitor: actions displayed as function progresses
-Dependencies: createDataNode, compareRoomNumbers, findBalanceFactor,
-              insert (recursively), printf, rotateLeft, rotateRight
+Device output/monitor: balancing cases logged at trace level
+Dependencies: createTreeNodeInArena, compareRoomKeys, unshareNode,
+              findBalanceFactor, insertInArena (recursively), LOG_TRACE,
+              rotateLeft, rotateRight, updateNodeHeight
 */
-AvlTreeNodeType *insert( AvlTreeNodeType *wkgPtr, 
+AvlTreeNodeType *insertInArena( NodeArenaType *arenaPtr, 
+                                AvlTreeNodeType *wkgPtr, 
+                                unsigned long long roomKey,
                      char *rmNmbr, char *bldgRm, char *clsSetup, int capacity );
 
+/*
+Name: internClassSetup
+Process: finds id of class setup name in shared dictionary, 
+         adding name if not yet stored, safe to call from several threads;
+         empty name, or new name when dictionary is full, 
+         gives EMPTY_CLASS_SETUP_ID
+Function input/parameters: class setup name (const char *)
+Function output/parameters: none
+Function output/returned: class setup id (unsigned short)
+Device input/---: none
+Device output/---: none
+Dependencies: accessClassSetupDictionary, pthread_mutex_lock, 
+              resizeClassSetupIndex, findStringHash, isSameString,
+              findClassSetupName, malloc, sizeof, copyStringWithLimit,
+              pthread_mutex_unlock
+*/
+unsigned short internClassSetup( const char *setupName );
+
 /*
 Name: isDigit
 Process: reports if character provided is a character digit
@@ -237,45 +950,409 @@ Dependencies: none
 */
 bool isEmpty( AvlTreeNodeType *rootPtr );
 
+/*
+Name: isIteratorDone
+Process: tests for iterator with no nodes left
+Function input/parameters: iterator (const TreeIteratorType *)
+Function output/parameters: none
+Function output/returned: Boolean result of test (bool)
+Device input/---: none
+Device output/---: none
+Dependencies: none
+*/
+bool isIteratorDone( const TreeIteratorType *iteratorPtr );
+
+/*
+Name: isSameString
+Process: tests two strings for equal content
+Function input/parameters: two strings (const char *)
+Function output/parameters: none
+Function output/returned: Boolean result of test (bool)
+Device input/---: none
+Device output/---: none
+Dependencies: none
+*/
+bool isSameString( const char *stringOne, const char *stringTwo );
+
+/*
+Name: loadLeftPath
+Process: pushes given node and all its left descendants onto iterator stack
+Function input/parameters: iterator (TreeIteratorType *), 
+                           subtree root (AvlTreeNodeType *)
+Function output/parameters: iterator with path loaded (TreeIteratorType *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: isEmpty
+*/
+void loadLeftPath( TreeIteratorType *iteratorPtr, AvlTreeNodeType *wkgPtr );
+
+/*
+Name: mergeNodeArenas
+Process: moves all slabs and released nodes of source arena to
+         destination arena, then releases source arena and its strings;
+         nodes keep their arena pointer, so source arena is used only
+         as a place to take nodes from
+Function input/parameters: destination arena (NodeArenaType *),
+                           source arena (NodeArenaType *)
+Function output/parameters: destination arena with added slabs
+                            (NodeArenaType *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: free
+*/
+void mergeNodeArenas( NodeArenaType *destArenaPtr, NodeArenaType *srcArenaPtr );
+
+/*
+Name: rangeQuery
+Process: calls visit function for every node with room number 
+         from low to high bound inclusive, in room number order,
+         subtrees wholly outside bounds are not visited
+Function input/parameters: tree root (AvlTreeNodeType *),
+                           low and high room numbers (const char *),
+                           visit function (RoomVisitFunction),
+                           caller data passed to visit function (void *)
+Function output/parameters: none
+Function output/returned: number of nodes visited (int)
+Device input/---: none
+Device output/---: none
+Dependencies: createRoomKey, visitRange
+*/
+int rangeQuery( AvlTreeNodeType *rootPtr, const char *lowRoomNumber,
+                    const char *highRoomNumber, RoomVisitFunction visitFunction,
+                                                           void *contextPtr );
+
+/*
+Name: rebalanceNode
+Process: updates stored height of node, then rotates if its subtrees
+         differ in height by more than one, choosing case from balance
+         factor of taller child, as needed after removal
+Function input/parameters: pointer to current tree location (AvlTreeNodeType *)
+Function output/parameters: none
+Function output/returned: pointer to root of balanced subtree
+Device input/---: none
+Device output/monitor: rotations logged at trace level
+Dependencies: updateNodeHeight, findBalanceFactor, rotateLeft, rotateRight
+*/
+AvlTreeNodeType *rebalanceNode( AvlTreeNodeType *wkgPtr );
+
+/*
+Name: releaseArenaNode
+Process: returns single node to free list of the arena it came from,
+         so storage is reused by next allocation from that arena
+Function input/parameters: node to release (AvlTreeNodeType *)
+Function output/parameters: none
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: none
+*/
+void releaseArenaNode( AvlTreeNodeType *nodePtr );
+
+/*
+Name: releaseNodeReference
+Process: drops one link to node, node no tree links to any longer
+         drops its links to its children and is returned to its arena
+Function input/parameters: node, may be NULL (AvlTreeNodeType *)
+Function output/parameters: none
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: isEmpty, releaseNodeReference (recursively), releaseArenaNode
+*/
+void releaseNodeReference( AvlTreeNodeType *nodePtr );
+
+/*
+Name: removeFromTree
+Process: recursively finds node with room number and returns it to its
+         arena, a node with two children is replaced by relinking its
+         in order successor, then follows recursion back up tree
+         to implement balancing; shared nodes on the path are copied,
+         room number not found changes nothing
+Function input/parameters: pointer to current tree location (AvlTreeNodeType *),
+                           ordering key of room number (unsigned long long),
+                           room number (const char *)
+Function output/parameters: none
+Function output/returned: pointer to calling function/tree node above
+                          where function is called
+Device input/---: none
+Device output/monitor: removal and rotations logged at trace level
+Dependencies: isEmpty, unshareNode, compareRoomKeys,
+              removeFromTree (recursively), releaseArenaNode, LOG_TRACE,
+              detachMinNode, rebalanceNode
+*/
+AvlTreeNodeType *removeFromTree( AvlTreeNodeType *wkgPtr, 
+                         unsigned long long roomKey, const char *roomNumber );
+
+/*
+Name: removeNode
+Process: removes room with given room number from tree, if found,
+         rebalancing along the path, arena is released when last node
+         is removed and no copy uses it; pointers to other nodes stay
+         valid unless tree shares nodes with copies
+Function input/parameters: pointer to tree root (AvlTreeNodeType *),
+                           room number (const char *)
+Function output/parameters: none
+Function output/returned: pointer to root of tree, NULL when tree is empty
+Device input/---: none
+Device output/monitor: removal and rotations logged at trace level
+Dependencies: isEmpty, search, createRoomKey, removeFromTree, clearNodeArena
+*/
+AvlTreeNodeType *removeNode( AvlTreeNodeType *rootPtr, const char *roomNumber );
+
+/*
+Name: resizeClassSetupIndex
+Process: doubles hash index of class setup dictionary 
+         and re-inserts every stored id, caller holds dictionary lock
+Function input/parameters: dictionary (ClassSetupDictionaryType *)
+Function output/parameters: dictionary with larger index 
+                            (ClassSetupDictionaryType *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: findMax, malloc, sizeof, findStringHash, findClassSetupName,
+              free
+*/
+void resizeClassSetupIndex( ClassSetupDictionaryType *dictionaryPtr );
+
 /*
 Name: rotateLeft
-Process: conducts left rotation by manipulation of given pointer
+Process: conducts left rotation by manipulation of given pointer,
+         either node moved is copied first if shared
 Function input/parameters: pointer to given subtree to rotate
 Function output/parameters: none
 Function output/returned: pointer to calling function/tree node above
                           where function is called
 Device input/---: none
-Device output/monitor: rotation action displayed  ("- Rotating Left")
-Dependencies: printf
+Device output/monitor: rotation action logged at trace level
+Dependencies: LOG_TRACE, unshareNode, updateNodeHeight
 */
 AvlTreeNodeType *rotateLeft( AvlTreeNodeType *oldParentPtr );
 
 /*
 Name: rotateRight
-Process: conducts right rotation by manipulation of given pointer
+Process: conducts right rotation by manipulation of given pointer,
+         either node moved is copied first if shared
 Function input/parameters: pointer to given subtree to rotate
 Function output/parameters: none
 Function output/returned: pointer to calling function/tree node above
                           where function is called
 Device input/---: none
-Device output/monitor: rotation action displayed  ("- Rotating Right")
-Dependencies: printf
+Device output/monitor: rotation action logged at trace level
+Dependencies: LOG_TRACE, unshareNode, updateNodeHeight
 */
 AvlTreeNodeType *rotateRight( AvlTreeNodeType *oldParentPtr );
 
 /*
 Name: search
-Process: recursively searches tree for specified data using room number key
+Process: iteratively searches tree for specified data using room number key,
+         ordering key of search room number is found once and compared
+         with stored node keys on the way down
 Function input/parameters: pointer to working subtree (AvlTreeNodeType *),
                            room number (const char *)
 Function output/parameters: none
-Function output/returned: pointer to found node (AvlTreeNodeType *)
+Function output/returned: pointer to found node or NULL (AvlTreeNodeType *)
 Device input/---: none
 Device output/---: none
-Dependencies: search (recursively)
+Dependencies: createRoomKey, isEmpty, compareRoomKeys
 */
 AvlTreeNodeType *search( AvlTreeNodeType *wkgPtr, const char *roomNumber );
 
+/*
+Name: searchMany
+Process: finds nodes for a batch of room numbers, 
+         walks groups of SEARCH_BATCH_WIDTH keys down the tree together,
+         one level per round, prefetching each next node 
+         so cache misses of different keys overlap
+Function input/parameters: tree root (AvlTreeNodeType *),
+                           room numbers (const char **), 
+                           number of room numbers (int)
+Function output/parameters: found node or NULL for each room number,
+                            same order as room numbers (AvlTreeNodeType **)
+Function output/returned: number of room numbers found (int)
+Device input/---: none
+Device output/---: none
+Dependencies: findMin, createRoomKey, compareRoomKeys, PREFETCH_READ
+*/
+int searchMany( AvlTreeNodeType *rootPtr, const char **roomNumbers, 
+                                 int numKeys, AvlTreeNodeType **foundPtrs );
+
+/*
+Name: sortRecordArray
+Process: stable merge sort of record pointers by room number,
+         ordering keys of records must already be set,
+         records that compare equal keep their original order
+Function input/parameters: record pointers (RoomRecordType **),
+                           number of records (int)
+Function output/parameters: sorted record pointers (RoomRecordType **)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: malloc, sizeof, findMin, compareRecordKeys, free
+*/
+void sortRecordArray( RoomRecordType **orderedPtrs, int numRecords );
+
+/*
+Name: storeArenaString
+Process: appends string to string heap of arena, limited to capacity,
+         heap grows by doubling, text already in same heap may be stored
+Function input/parameters: node arena (NodeArenaType *), 
+                           text (const char *), capacity (int)
+Function output/parameters: length of stored text (int *)
+Function output/returned: offset of stored text in heap (unsigned int)
+Device input/---: none
+Device output/---: none
+Dependencies: realloc, copyStringWithLimit
+*/
+unsigned int storeArenaString( NodeArenaType *arenaPtr, const char *text,
+                                               int capacity, int *lengthPtr );
+
+/*
+Name: unshareNode
+Process: provides node that only caller links to, for changing:
+         node is returned as is if so, otherwise it is copied in same
+         arena, caller's link moves to copy, children are linked from both
+Function input/parameters: node linked from caller (AvlTreeNodeType *)
+Function output/parameters: none
+Function output/returned: node caller may change (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: allocateArenaNode, isEmpty
+*/
+AvlTreeNodeType *unshareNode( AvlTreeNodeType *nodePtr );
+
+/*
+Name: updateInTree
+Process: recursively finds room and replaces its data as updateNodeData
+         does, shared nodes on the path are copied first,
+         room number not found changes nothing
+Function input/parameters: pointer to current tree location (AvlTreeNodeType *),
+                           ordering key of room number (unsigned long long),
+                           room number, building room data,
+                           class setup (const char *), capacity (int)
+Function output/parameters: none
+Function output/returned: pointer to calling function/tree node above
+                          where function is called
+Device input/---: none
+Device output/---: none
+Dependencies: isEmpty, unshareNode, compareRoomKeys,
+              updateInTree (recursively), updateNodeData
+*/
+AvlTreeNodeType *updateInTree( AvlTreeNodeType *wkgPtr, 
+                               unsigned long long roomKey, const char *rmNmbr,
+               const char *bldgRm, const char *clsSetup, int capacity );
+
+/*
+Name: updateNodeData
+Process: replaces building room data, class setup and capacity of node,
+         changed building room text is added to arena string heap,
+         space of old text is not reused until tree is cleared
+Function input/parameters: node to change (AvlTreeNodeType *),
+                           building room data, class setup (const char *),
+                           capacity (int)
+Function output/parameters: changed node (AvlTreeNodeType *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: internClassSetup, isSameString, accessBuildingRoom,
+              storeArenaString
+*/
+void updateNodeData( AvlTreeNodeType *nodePtr, 
+                 const char *buildingRm, const char *clsSetup, int capacity );
+
+/*
+Name: updateNodeHeight
+Process: resets stored node height from heights of its two subtrees,
+         must be called after any change to child pointers
+Function input/parameters: pointer to current tree location (AvlTreeNodeType *)
+Function output/parameters: none
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: findMax, findTreeHeight
+*/
+void updateNodeHeight( AvlTreeNodeType *wkgPtr );
+/*
+Name: upsert
+Process: updates data of room in place if room number is in tree,
+         or along a copied path if tree shares nodes with copies,
+         otherwise inserts it as insert does
+Function input/parameters: pointer to tree root (AvlTreeNodeType *),
+                           room number, building room data, class setup (char *)
+Function output/parameters: none
+Function output/returned: pointer to root of tree
+Device input/---: none
+Device output/monitor: balancing cases logged at trace level
+Dependencies: search, updateInTree, updateNodeData, insert
+*/
+AvlTreeNodeType *upsert( AvlTreeNodeType *wkgPtr, 
+                     char *rmNmbr, char *bldgRm, char *clsSetup, int capacity );
+
+/*
+Name: visitInOrder
+Process: calls visit function for every node in room number order,
+         using tree iterator, so no recursion
+Function input/parameters: tree root (AvlTreeNodeType *),
+                           visit function (RoomVisitFunction),
+                           caller data passed to visit function (void *)
+Function output/parameters: none
+Function output/returned: number of nodes visited (int)
+Device input/---: none
+Device output/---: none
+Dependencies: initializeTreeIterator, getNextTreeNode
+*/
+int visitInOrder( AvlTreeNodeType *rootPtr, RoomVisitFunction visitFunction,
+                                                           void *contextPtr );
+
+/*
+Name: visitRange
+Process: recursively visits nodes of subtree within range in order,
+         going left only when node is above low bound 
+         and right only when node is below high bound
+Function input/parameters: subtree root (AvlTreeNodeType *),
+                           range with visit function (const RoomRangeType *)
+Function output/parameters: none
+Function output/returned: number of nodes visited (int)
+Device input/---: none
+Device output/---: none
+Dependencies: isEmpty, compareRoomKeys, visitRange (recursively)
+*/
+int visitRange( AvlTreeNodeType *wkgPtr, const RoomRangeType *rangePtr );
+
+/*
+Name: writeInOrderRoomNumbers
+Process: adds room numbers of tree in order to writer, 
+         each followed by comma and space, using tree iterator
+Function input/parameters: writer (BufferedOutputWriterType *),
+                           tree root (AvlTreeNodeType *)
+Function output/parameters: none
+Function output/returned: number of room numbers written (int)
+Device input/---: none
+Device output/---: room numbers written when writer buffer fills
+Dependencies: initializeTreeIterator, getNextTreeNode,
+              writeStringToBufferedWriter, writeBytesToBufferedWriter
+*/
+int writeInOrderRoomNumbers( BufferedOutputWriterType *writerPtr, 
+                                                    AvlTreeNodeType *rootPtr );
+
+/*
+Name: writeNodeDisplay
+Process: adds one line with all data of node to writer
+Function input/parameters: writer (BufferedOutputWriterType *),
+                           node (const AvlTreeNodeType *)
+Function output/parameters: none
+Function output/returned: success of operation (bool)
+Device input/---: none
+Device output/---: node data written when writer buffer fills
+Dependencies: writeStringToBufferedWriter, writeIntegerToBufferedWriter,
+              writeCharacterToBufferedWriter, accessBuildingRoom, 
+              accessClassSetup
+*/
+bool writeNodeDisplay( BufferedOutputWriterType *writerPtr, 
+                                               const AvlTreeNodeType *nodePtr );
+
+
 
 
 #endif   // AVL_TREE_UTILITY_H
@@ -0,0 +1,152 @@
+// header files
+#include <algorithm>
+#include <map>
+#include <utility>
+#include <vector>
+#include "Benchmark_Baseline.h"
+
+// baseline container types
+typedef std::map< unsigned long long, const void * > BaselineMapType;
+
+typedef std::vector< std::pair< unsigned long long, const void * > >
+                                                        BaselineVectorType;
+
+// orders vector entries by key only, so first value of a key stays first
+static bool compareBaselineKeys(
+                  const std::pair< unsigned long long, const void * > &one,
+                  const std::pair< unsigned long long, const void * > &other )
+{
+    return one.first < other.first;
+}
+
+// tests vector entries for same key
+static bool isSameBaselineKey(
+                  const std::pair< unsigned long long, const void * > &one,
+                  const std::pair< unsigned long long, const void * > &other )
+{
+    return one.first == other.first;
+}
+
+void clearMapBaseline(void* mapPtr)
+{
+    delete static_cast< BaselineMapType * >( mapPtr );
+}
+
+void clearVectorBaseline(void* vectorPtr)
+{
+    delete static_cast< BaselineVectorType * >( vectorPtr );
+}
+
+void* copyMapBaseline(void* mapPtr)
+{
+    return new BaselineMapType( *static_cast< BaselineMapType * >( mapPtr ) );
+}
+
+void* copyVectorBaseline(void* vectorPtr)
+{
+    return new BaselineVectorType(
+                           *static_cast< BaselineVectorType * >( vectorPtr ) );
+}
+
+void* createMapBaseline(const unsigned long long* keys, const void** values,
+                                                                   int numKeys)
+{
+    // initialize variables
+    BaselineMapType *mapPtr = new BaselineMapType();
+    int index;
+
+    // insert one at a time, existing key is kept
+    for ( index = 0; index < numKeys; index++ )
+    {
+        mapPtr->insert( std::make_pair( keys[ index ], values[ index ] ) );
+    }
+
+    // return new map
+    return mapPtr;
+}
+
+void* createVectorBaseline(const unsigned long long* keys,
+                                             const void** values, int numKeys)
+{
+    // initialize variables
+    BaselineVectorType *vectorPtr = new BaselineVectorType();
+    int index;
+
+    // append all entries
+    vectorPtr->reserve( numKeys );
+
+    for ( index = 0; index < numKeys; index++ )
+    {
+        vectorPtr->push_back(
+                          std::make_pair( keys[ index ], values[ index ] ) );
+    }
+
+    // sort, keeping first of each key
+    std::stable_sort( vectorPtr->begin(), vectorPtr->end(),
+                                                         compareBaselineKeys );
+    vectorPtr->erase( std::unique( vectorPtr->begin(), vectorPtr->end(),
+                                   isSameBaselineKey ), vectorPtr->end() );
+
+    // return new vector
+    return vectorPtr;
+}
+
+const void* searchMapBaseline(void* mapPtr, unsigned long long key)
+{
+    // initialize variables
+    BaselineMapType *basePtr = static_cast< BaselineMapType * >( mapPtr );
+    BaselineMapType::const_iterator found = basePtr->find( key );
+
+    // return value or not found
+    return found == basePtr->end() ? NULL : found->second;
+}
+
+const void* searchVectorBaseline(void* vectorPtr, unsigned long long key)
+{
+    // initialize variables
+    BaselineVectorType *basePtr =
+                               static_cast< BaselineVectorType * >( vectorPtr );
+    BaselineVectorType::const_iterator found = std::lower_bound(
+                              basePtr->begin(), basePtr->end(),
+                              std::make_pair( key, (const void *)NULL ),
+                                                         compareBaselineKeys );
+
+    // return value or not found
+    return found == basePtr->end() || found->first != key
+                                                       ? NULL : found->second;
+}
+
+long traverseMapBaseline(void* mapPtr)
+{
+    // initialize variables
+    BaselineMapType *basePtr = static_cast< BaselineMapType * >( mapPtr );
+    BaselineMapType::const_iterator wkgIter;
+    long numVisited = 0;
+
+    // visit in key order, touching each value
+    for ( wkgIter = basePtr->begin(); wkgIter != basePtr->end(); ++wkgIter )
+    {
+        numVisited += wkgIter->second != NULL;
+    }
+
+    // return number visited
+    return numVisited;
+}
+
+long traverseVectorBaseline(void* vectorPtr)
+{
+    // initialize variables
+    BaselineVectorType *basePtr =
+                               static_cast< BaselineVectorType * >( vectorPtr );
+    BaselineVectorType::const_iterator wkgIter;
+    long numVisited = 0;
+
+    // visit in key order, touching each value
+    for ( wkgIter = basePtr->begin(); wkgIter != basePtr->end(); ++wkgIter )
+    {
+        numVisited += wkgIter->second != NULL;
+    }
+
+    // return number visited
+    return numVisited;
+}
@@ -0,0 +1,145 @@
+#ifndef BENCHMARK_BASELINE_H
+#define BENCHMARK_BASELINE_H
+
+// Baseline containers for the benchmark, written in C++ with C linkage,
+// keyed by packed room keys from createRoomKey with record pointers
+// as values, so they measure container cost without string handling
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Prototypes
+
+/*
+Name: clearMapBaseline
+Process: releases std::map baseline and all its entries
+Function input/parameters: map baseline (void *)
+Function output/parameters: none
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: delete
+*/
+void clearMapBaseline( void *mapPtr );
+
+/*
+Name: clearVectorBaseline
+Process: releases sorted vector baseline
+Function input/parameters: vector baseline (void *)
+Function output/parameters: none
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: delete
+*/
+void clearVectorBaseline( void *vectorPtr );
+
+/*
+Name: copyMapBaseline
+Process: creates deep copy of std::map baseline
+Function input/parameters: map baseline (void *)
+Function output/parameters: none
+Function output/returned: new map baseline (void *)
+Device input/---: none
+Device output/---: none
+Dependencies: new
+*/
+void *copyMapBaseline( void *mapPtr );
+
+/*
+Name: copyVectorBaseline
+Process: creates copy of sorted vector baseline
+Function input/parameters: vector baseline (void *)
+Function output/parameters: none
+Function output/returned: new vector baseline (void *)
+Device input/---: none
+Device output/---: none
+Dependencies: new
+*/
+void *copyVectorBaseline( void *vectorPtr );
+
+/*
+Name: createMapBaseline
+Process: creates std::map baseline, inserting entries one at a time,
+         first value kept for repeated keys
+Function input/parameters: keys (const unsigned long long *),
+                           values (const void **), number of entries (int)
+Function output/parameters: none
+Function output/returned: new map baseline (void *)
+Device input/---: none
+Device output/---: none
+Dependencies: new, std::map::insert
+*/
+void *createMapBaseline( const unsigned long long *keys, const void **values,
+                                                                int numKeys );
+
+/*
+Name: createVectorBaseline
+Process: creates sorted vector baseline, appending all entries,
+         then sorting and dropping repeated keys, first value kept
+Function input/parameters: keys (const unsigned long long *),
+                           values (const void **), number of entries (int)
+Function output/parameters: none
+Function output/returned: new vector baseline (void *)
+Device input/---: none
+Device output/---: none
+Dependencies: new, std::stable_sort, std::unique
+*/
+void *createVectorBaseline( const unsigned long long *keys,
+                                         const void **values, int numKeys );
+
+/*
+Name: searchMapBaseline
+Process: finds value stored for key in std::map baseline
+Function input/parameters: map baseline (void *), key (unsigned long long)
+Function output/parameters: none
+Function output/returned: value or NULL if not found (const void *)
+Device input/---: none
+Device output/---: none
+Dependencies: std::map::find
+*/
+const void *searchMapBaseline( void *mapPtr, unsigned long long key );
+
+/*
+Name: searchVectorBaseline
+Process: binary searches sorted vector baseline for key
+Function input/parameters: vector baseline (void *),
+                           key (unsigned long long)
+Function output/parameters: none
+Function output/returned: value or NULL if not found (const void *)
+Device input/---: none
+Device output/---: none
+Dependencies: std::lower_bound
+*/
+const void *searchVectorBaseline( void *vectorPtr, unsigned long long key );
+
+/*
+Name: traverseMapBaseline
+Process: visits entries of std::map baseline in key order
+Function input/parameters: map baseline (void *)
+Function output/parameters: none
+Function output/returned: number of entries visited (long)
+Device input/---: none
+Device output/---: none
+Dependencies: none
+*/
+long traverseMapBaseline( void *mapPtr );
+
+/*
+Name: traverseVectorBaseline
+Process: visits entries of sorted vector baseline in key order
+Function input/parameters: vector baseline (void *)
+Function output/parameters: none
+Function output/returned: number of entries visited (long)
+Device input/---: none
+Device output/---: none
+Dependencies: none
+*/
+long traverseVectorBaseline( void *vectorPtr );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif   // BENCHMARK_BASELINE_H
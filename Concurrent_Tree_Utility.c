@@ -0,0 +1,394 @@
+// header files
+#include "Concurrent_Tree_Utility.h"
+
+int addConcurrentReader(ConcurrentTreeType* treePtr)
+{
+    // initialize variables
+    int readerId, numReaders, isTaken;
+
+    // loop across slots to first one no reader holds
+    for ( readerId = 0; readerId < MAX_CONCURRENT_READERS; readerId++ )
+    {
+        isTaken = 0;
+
+        // check for slot taken by this thread
+        if ( __atomic_compare_exchange_n(
+                       &treePtr->readerSlots[ readerId ].isTaken, &isTaken, 1,
+                            false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST ) )
+        {
+            // writers look at slots up to highest ever taken
+            numReaders = __atomic_load_n( &treePtr->numReaders,
+                                                           __ATOMIC_SEQ_CST );
+
+            while ( numReaders <= readerId
+                     && !__atomic_compare_exchange_n( &treePtr->numReaders,
+                                &numReaders, readerId + 1, false,
+                                        __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST ) )
+            {
+                // numReaders reloaded by failed exchange
+            }
+
+            // return slot of new reader
+            return readerId;
+        }
+    }
+
+    // return all slots taken
+    return -1;
+}
+
+ConcurrentTreeType* clearConcurrentTree(ConcurrentTreeType* treePtr)
+{
+    // no reader is left, so every retired item can go
+    reclaimRetiredItems( treePtr, ~0ULL );
+
+    // release published tree
+    clearTree( treePtr->rootPtr );
+
+    // release slots, lock and concurrent tree
+    free( treePtr->slotBlockPtr );
+    pthread_mutex_destroy( &treePtr->writerLock );
+    free( treePtr );
+
+    // return cleared tree ptr
+    return NULL;
+}
+
+ConcurrentTreeType* createConcurrentTree(AvlTreeNodeType* rootPtr)
+{
+    // initialize variables
+    ConcurrentTreeType *treePtr;
+    size_t slotAddress;
+    int index;
+
+    // create concurrent tree publishing given tree
+    treePtr = (ConcurrentTreeType *)malloc( sizeof(ConcurrentTreeType) );
+    treePtr->rootPtr = rootPtr;
+
+    // epoch starts after NO_READER_EPOCH
+    treePtr->globalEpoch = NO_READER_EPOCH + 1;
+
+    // create reader slots on cache line boundary, all readers outside
+    treePtr->slotBlockPtr = malloc( MAX_CONCURRENT_READERS
+                            * sizeof(ReaderSlotType) + READER_SLOT_ALIGNMENT );
+    slotAddress = (size_t)treePtr->slotBlockPtr + READER_SLOT_ALIGNMENT - 1;
+    slotAddress -= slotAddress % READER_SLOT_ALIGNMENT;
+    treePtr->readerSlots = (ReaderSlotType *)slotAddress;
+
+    for ( index = 0; index < MAX_CONCURRENT_READERS; index++ )
+    {
+        treePtr->readerSlots[ index ].epoch = NO_READER_EPOCH;
+        treePtr->readerSlots[ index ].isTaken = 0;
+    }
+
+    treePtr->numReaders = 0;
+
+    // nothing retired yet
+    treePtr->retiredHeadPtr = NULL;
+    treePtr->retiredTailPtr = NULL;
+
+    pthread_mutex_init( &treePtr->writerLock, NULL );
+
+    // return new concurrent tree
+    return treePtr;
+}
+
+unsigned long long findOldestReaderEpoch(ConcurrentTreeType* treePtr)
+{
+    // initialize variables
+    unsigned long long oldestEpoch, readerEpoch;
+    int numReaders = findMin( MAX_CONCURRENT_READERS,
+                  __atomic_load_n( &treePtr->numReaders, __ATOMIC_SEQ_CST ) );
+    int readerId;
+
+    // start past current epoch, as if no reader is searching
+    oldestEpoch = __atomic_load_n( &treePtr->globalEpoch,
+                                                       __ATOMIC_SEQ_CST ) + 1;
+
+    // loop across reader slots
+    for ( readerId = 0; readerId < numReaders; readerId++ )
+    {
+        readerEpoch = __atomic_load_n( &treePtr->readerSlots[ readerId ].epoch,
+                                                           __ATOMIC_SEQ_CST );
+
+        // check for reader searching since an older epoch
+        if ( readerEpoch != NO_READER_EPOCH && readerEpoch < oldestEpoch )
+        {
+            oldestEpoch = readerEpoch;
+        }
+    }
+
+    // return oldest epoch still in use
+    return oldestEpoch;
+}
+
+void insertConcurrentTree(ConcurrentTreeType* treePtr,
+    char* rmNmbr, char* bldgRm, char* clsSetup, int capacity)
+{
+    // initialize variables
+    AvlTreeNodeType *oldRootPtr, *newRootPtr;
+
+    pthread_mutex_lock( &treePtr->writerLock );
+
+    // change copy sharing all nodes, only insert path is copied
+    oldRootPtr = treePtr->rootPtr;
+    reserveConcurrentStringSpace( treePtr );
+
+    newRootPtr = copyTree( oldRootPtr );
+    newRootPtr = insert( newRootPtr, rmNmbr, bldgRm, clsSetup, capacity );
+
+    publishConcurrentRoot( treePtr, oldRootPtr, newRootPtr );
+
+    pthread_mutex_unlock( &treePtr->writerLock );
+}
+
+void publishConcurrentRoot(ConcurrentTreeType* treePtr,
+                      AvlTreeNodeType* oldRootPtr, AvlTreeNodeType* newRootPtr)
+{
+    // check for copy that nothing was changed in
+    if ( newRootPtr == oldRootPtr )
+    {
+        // drop copy, shares every node with published tree
+        clearTree( newRootPtr );
+
+        return;
+    }
+
+    // readers finding root from now on search new version
+    __atomic_store_n( &treePtr->rootPtr, newRootPtr, __ATOMIC_SEQ_CST );
+
+    // check for old version to free once no reader can see it
+    if ( !isEmpty( oldRootPtr ) )
+    {
+        retireConcurrentItem( treePtr, oldRootPtr, NULL );
+    }
+
+    // readers entering after this cannot find old version
+    __atomic_add_fetch( &treePtr->globalEpoch, 1, __ATOMIC_SEQ_CST );
+
+    // free what readers have left
+    reclaimRetiredItems( treePtr, findOldestReaderEpoch( treePtr ) );
+}
+
+void reclaimRetiredItems(ConcurrentTreeType* treePtr,
+                                                unsigned long long oldestEpoch)
+{
+    // initialize variables
+    RetiredItemType *itemPtr;
+
+    // loop across items retired before oldest epoch, oldest first
+    while ( treePtr->retiredHeadPtr != NULL
+                             && treePtr->retiredHeadPtr->epoch < oldestEpoch )
+    {
+        // unlink item
+        itemPtr = treePtr->retiredHeadPtr;
+        treePtr->retiredHeadPtr = itemPtr->nextPtr;
+
+        // release nodes only this version links to, or heap
+        clearTree( itemPtr->rootPtr );
+        free( itemPtr->stringHeapPtr );
+
+        free( itemPtr );
+    }
+
+    // check for list emptied
+    if ( treePtr->retiredHeadPtr == NULL )
+    {
+        treePtr->retiredTailPtr = NULL;
+    }
+}
+
+void removeFromConcurrentTree(ConcurrentTreeType* treePtr,
+                                                        const char* roomNumber)
+{
+    // initialize variables
+    AvlTreeNodeType *oldRootPtr, *newRootPtr;
+
+    pthread_mutex_lock( &treePtr->writerLock );
+
+    // change copy sharing all nodes, only removal path is copied
+    oldRootPtr = treePtr->rootPtr;
+
+    newRootPtr = copyTree( oldRootPtr );
+    newRootPtr = removeNode( newRootPtr, roomNumber );
+
+    publishConcurrentRoot( treePtr, oldRootPtr, newRootPtr );
+
+    pthread_mutex_unlock( &treePtr->writerLock );
+}
+
+void removeConcurrentReader(ConcurrentTreeType* treePtr, int readerId)
+{
+    // check for id of no slot
+    if ( readerId < 0 || readerId >= MAX_CONCURRENT_READERS )
+    {
+        return;
+    }
+
+    // leave slot outside any search, then free it for next reader
+    __atomic_store_n( &treePtr->readerSlots[ readerId ].epoch,
+                                          NO_READER_EPOCH, __ATOMIC_SEQ_CST );
+    __atomic_store_n( &treePtr->readerSlots[ readerId ].isTaken, 0,
+                                                           __ATOMIC_RELEASE );
+}
+
+void replaceConcurrentTree(ConcurrentTreeType* treePtr,
+                                                      AvlTreeNodeType* rootPtr)
+{
+    pthread_mutex_lock( &treePtr->writerLock );
+
+    // new tree replaces published tree whole
+    publishConcurrentRoot( treePtr, treePtr->rootPtr, rootPtr );
+
+    pthread_mutex_unlock( &treePtr->writerLock );
+}
+
+void reserveConcurrentStringSpace(ConcurrentTreeType* treePtr)
+{
+    // initialize variables
+    NodeArenaType *arenaPtr;
+    char *newHeapPtr;
+    unsigned int newCapacity, index;
+
+    // check for empty tree, new arena is not seen before it is published
+    if ( isEmpty( treePtr->rootPtr ) )
+    {
+        return;
+    }
+
+    arenaPtr = treePtr->rootPtr->arenaPtr;
+
+    // check for room for longest allowed text
+    if ( arenaPtr->heapUsed + BUILDING_ROOM_CAPACITY
+                                                  <= arenaPtr->heapCapacity )
+    {
+        return;
+    }
+
+    // find larger capacity as storeArenaString would
+    newCapacity = arenaPtr->heapCapacity;
+
+    if ( newCapacity == 0 )
+    {
+        newCapacity = INITIAL_STRING_HEAP_CAPACITY;
+    }
+
+    while ( arenaPtr->heapUsed + BUILDING_ROOM_CAPACITY > newCapacity )
+    {
+        newCapacity *= 2;
+    }
+
+    // copy text to new heap, offsets stay the same
+    newHeapPtr = (char *)malloc( newCapacity );
+
+    for ( index = 0; index < arenaPtr->heapUsed; index++ )
+    {
+        newHeapPtr[ index ] = arenaPtr->stringHeapPtr[ index ];
+    }
+
+    // check for old heap, readers may still be reading it
+    if ( arenaPtr->stringHeapPtr != NULL )
+    {
+        retireConcurrentItem( treePtr, NULL, arenaPtr->stringHeapPtr );
+    }
+
+    // readers reading heap from now on find copy
+    __atomic_store_n( &arenaPtr->stringHeapPtr, newHeapPtr, __ATOMIC_RELEASE );
+    arenaPtr->heapCapacity = newCapacity;
+}
+
+void retireConcurrentItem(ConcurrentTreeType* treePtr,
+                                       AvlTreeNodeType* rootPtr, char* heapPtr)
+{
+    // initialize variables
+    RetiredItemType *itemPtr
+                       = (RetiredItemType *)malloc( sizeof(RetiredItemType) );
+
+    // record item with epoch readers that may see it are in
+    itemPtr->rootPtr = rootPtr;
+    itemPtr->stringHeapPtr = heapPtr;
+    itemPtr->epoch = __atomic_load_n( &treePtr->globalEpoch,
+                                                           __ATOMIC_SEQ_CST );
+    itemPtr->nextPtr = NULL;
+
+    // add to end of list, which stays in epoch order
+    if ( treePtr->retiredTailPtr == NULL )
+    {
+        treePtr->retiredHeadPtr = itemPtr;
+    }
+    else
+    {
+        treePtr->retiredTailPtr->nextPtr = itemPtr;
+    }
+
+    treePtr->retiredTailPtr = itemPtr;
+}
+
+bool searchConcurrentTree(ConcurrentTreeType* treePtr, int readerId,
+                          const char* roomNumber, RoomRecordType* recordPtr)
+{
+    // initialize variables
+    ReaderSlotType *slotPtr;
+    AvlTreeNodeType *rootPtr, *foundPtr;
+    const char *heapPtr;
+
+    // check for id of no slot
+    if ( readerId < 0 || readerId >= MAX_CONCURRENT_READERS )
+    {
+        return false;
+    }
+
+    slotPtr = &treePtr->readerSlots[ readerId ];
+
+    // announce epoch before finding root, so no version this reader
+    // can find is freed until it leaves
+    __atomic_store_n( &slotPtr->epoch,
+             __atomic_load_n( &treePtr->globalEpoch, __ATOMIC_SEQ_CST ),
+                                                           __ATOMIC_SEQ_CST );
+
+    // search published version, which no writer changes
+    rootPtr = __atomic_load_n( &treePtr->rootPtr, __ATOMIC_SEQ_CST );
+    foundPtr = search( rootPtr, roomNumber );
+
+    // check for room found
+    if ( foundPtr != NULL )
+    {
+        // copy data out while nodes and text are still held
+        heapPtr = __atomic_load_n( &foundPtr->arenaPtr->stringHeapPtr,
+                                                           __ATOMIC_ACQUIRE );
+
+        copyString( recordPtr->roomNumber, foundPtr->roomNumber );
+        recordPtr->roomKey = foundPtr->roomKey;
+        copyStringWithLimit( recordPtr->buildingRoom,
+                    heapPtr + foundPtr->buildingRoomOffset,
+                                                     BUILDING_ROOM_CAPACITY );
+        copyString( recordPtr->classSetup, accessClassSetup( foundPtr ) );
+        recordPtr->roomCapacity = foundPtr->roomCapacity;
+    }
+
+    // leave, retired items may now be freed
+    __atomic_store_n( &slotPtr->epoch, NO_READER_EPOCH, __ATOMIC_RELEASE );
+
+    // return result of search
+    return foundPtr != NULL;
+}
+
+void upsertConcurrentTree(ConcurrentTreeType* treePtr,
+    char* rmNmbr, char* bldgRm, char* clsSetup, int capacity)
+{
+    // initialize variables
+    AvlTreeNodeType *oldRootPtr, *newRootPtr;
+
+    pthread_mutex_lock( &treePtr->writerLock );
+
+    // change copy sharing all nodes, only path to room is copied
+    oldRootPtr = treePtr->rootPtr;
+    reserveConcurrentStringSpace( treePtr );
+
+    newRootPtr = copyTree( oldRootPtr );
+    newRootPtr = upsert( newRootPtr, rmNmbr, bldgRm, clsSetup, capacity );
+
+    publishConcurrentRoot( treePtr, oldRootPtr, newRootPtr );
+
+    pthread_mutex_unlock( &treePtr->writerLock );
+}
@@ -0,0 +1,298 @@
+#ifndef CONCURRENT_TREE_UTILITY_H
+#define CONCURRENT_TREE_UTILITY_H
+
+// Header files
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include "AVL_Tree_Utility.h"
+
+// Constants
+
+typedef enum { MAX_CONCURRENT_READERS = 64,
+                               READER_SLOT_ALIGNMENT = 64 } ConcurrentLimits;
+
+// reader slot epoch when reader is not in a search
+#define NO_READER_EPOCH 0ULL
+
+// Data Structures
+
+// epoch reader announced on entering a search, and whether a reader
+// holds the slot; slots start on a cache line and fill one each, so
+// readers do not slow each other down
+typedef struct ReaderSlotStruct
+   {
+    unsigned long long epoch;
+
+    int isTaken;
+
+    char padding[ READER_SLOT_ALIGNMENT - sizeof(unsigned long long)
+                                                             - sizeof(int) ];
+   } ReaderSlotType;
+
+// old tree version or old string heap, freed once no reader that
+// could have seen it is still searching
+typedef struct RetiredItemStruct
+   {
+    AvlTreeNodeType *rootPtr;
+
+    char *stringHeapPtr;
+
+    unsigned long long epoch;
+
+    struct RetiredItemStruct *nextPtr;
+   } RetiredItemType;
+
+// published root is replaced, never changed: writers change a copy
+// sharing all unchanged nodes, then publish its root; root, global
+// epoch, reader slots, number of slots ever taken and arena string
+// heap pointer are read and written with atomic builtins, other
+// fields only by writers
+typedef struct ConcurrentTreeStruct
+   {
+    ReaderSlotType *readerSlots;
+
+    void *slotBlockPtr;
+
+    AvlTreeNodeType *rootPtr;
+
+    unsigned long long globalEpoch;
+
+    int numReaders;
+
+    RetiredItemType *retiredHeadPtr, *retiredTailPtr;
+
+    pthread_mutex_t writerLock;
+   } ConcurrentTreeType;
+
+// Prototypes
+
+/*
+Name: addConcurrentReader
+Process: gives calling thread its own reader slot, the first slot no
+         reader holds; each thread that searches takes one slot once,
+         uses it for every search, and gives it back with
+         removeConcurrentReader when it is done
+Function input/parameters: concurrent tree (ConcurrentTreeType *)
+Function output/parameters: none
+Function output/returned: reader id, or -1 if all
+                          MAX_CONCURRENT_READERS slots are taken (int)
+Device input/---: none
+Device output/---: none
+Dependencies: none
+*/
+int addConcurrentReader( ConcurrentTreeType *treePtr );
+
+/*
+Name: clearConcurrentTree
+Process: releases published tree, every retired version and heap, and
+         concurrent tree itself, no other thread may be using it
+Function input/parameters: concurrent tree (ConcurrentTreeType *)
+Function output/parameters: none
+Function output/returned: NULL
+Device input/---: none
+Device output/---: none
+Dependencies: reclaimRetiredItems, clearTree, pthread_mutex_destroy, free
+*/
+ConcurrentTreeType *clearConcurrentTree( ConcurrentTreeType *treePtr );
+
+/*
+Name: createConcurrentTree
+Process: creates concurrent tree publishing given tree, which it then
+         owns; given tree may be empty
+Function input/parameters: tree root (AvlTreeNodeType *)
+Function output/parameters: none
+Function output/returned: new concurrent tree (ConcurrentTreeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: malloc, sizeof, pthread_mutex_init
+*/
+ConcurrentTreeType *createConcurrentTree( AvlTreeNodeType *rootPtr );
+
+/*
+Name: findOldestReaderEpoch
+Process: finds oldest epoch announced by a reader still in a search
+Function input/parameters: concurrent tree (ConcurrentTreeType *)
+Function output/parameters: none
+Function output/returned: oldest epoch, or one past global epoch if no
+                          reader is searching (unsigned long long)
+Device input/---: none
+Device output/---: none
+Dependencies: findMin
+*/
+unsigned long long findOldestReaderEpoch( ConcurrentTreeType *treePtr );
+
+/*
+Name: insertConcurrentTree
+Process: inserts room as insert does into copy of published tree,
+         then publishes copy; writers wait for each other, never for
+         readers; room already in tree changes nothing
+Function input/parameters: concurrent tree (ConcurrentTreeType *),
+                           room number, building room data, class setup
+                           (char *), capacity (int)
+Function output/parameters: none
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: pthread_mutex_lock, reserveConcurrentStringSpace, copyTree,
+              insert, publishConcurrentRoot, pthread_mutex_unlock
+*/
+void insertConcurrentTree( ConcurrentTreeType *treePtr,
+                     char *rmNmbr, char *bldgRm, char *clsSetup, int capacity );
+
+/*
+Name: publishConcurrentRoot
+Process: makes changed copy visible to readers, then retires old version
+         at current epoch, moves global epoch on, and frees retired
+         items no reader can still see; caller holds writer lock
+Function input/parameters: concurrent tree (ConcurrentTreeType *),
+                           old and new roots (AvlTreeNodeType *)
+Function output/parameters: concurrent tree with new root
+                            (ConcurrentTreeType *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: clearTree, isEmpty, retireConcurrentItem, reclaimRetiredItems,
+              findOldestReaderEpoch
+*/
+void publishConcurrentRoot( ConcurrentTreeType *treePtr,
+                    AvlTreeNodeType *oldRootPtr, AvlTreeNodeType *newRootPtr );
+
+/*
+Name: reclaimRetiredItems
+Process: frees retired tree versions and string heaps retired before
+         given epoch: version's nodes no newer version links to go back
+         to arena, whole arena when no version uses it any longer
+Function input/parameters: concurrent tree (ConcurrentTreeType *),
+                           oldest epoch a reader may still be in
+                           (unsigned long long)
+Function output/parameters: concurrent tree with fewer retired items
+                            (ConcurrentTreeType *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: clearTree, free
+*/
+void reclaimRetiredItems( ConcurrentTreeType *treePtr,
+                                               unsigned long long oldestEpoch );
+
+/*
+Name: removeFromConcurrentTree
+Process: removes room as removeNode does from copy of published tree,
+         then publishes copy; room not found changes nothing
+Function input/parameters: concurrent tree (ConcurrentTreeType *),
+                           room number (const char *)
+Function output/parameters: none
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: pthread_mutex_lock, copyTree, removeNode,
+              publishConcurrentRoot, pthread_mutex_unlock
+*/
+void removeFromConcurrentTree( ConcurrentTreeType *treePtr,
+                                                      const char *roomNumber );
+
+/*
+Name: removeConcurrentReader
+Process: gives back reader slot of thread that will search no more,
+         so a later addConcurrentReader can take it; reader must not
+         be in a search, id out of range is ignored
+Function input/parameters: concurrent tree (ConcurrentTreeType *),
+                           reader id from addConcurrentReader (int)
+Function output/parameters: concurrent tree with slot free
+                            (ConcurrentTreeType *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: none
+*/
+void removeConcurrentReader( ConcurrentTreeType *treePtr, int readerId );
+
+/*
+Name: replaceConcurrentTree
+Process: publishes whole new tree, such as one loaded again from file,
+         in place of published tree, which is freed once no reader
+         can still see it; concurrent tree owns new tree
+Function input/parameters: concurrent tree (ConcurrentTreeType *),
+                           new tree root (AvlTreeNodeType *)
+Function output/parameters: none
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: pthread_mutex_lock, publishConcurrentRoot,
+              pthread_mutex_unlock
+*/
+void replaceConcurrentTree( ConcurrentTreeType *treePtr,
+                                                  AvlTreeNodeType *rootPtr );
+
+/*
+Name: reserveConcurrentStringSpace
+Process: makes sure next building/room text stored in arena of published
+         tree fits without moving string heap, since readers may be
+         reading it: heap too full is copied to one twice as large,
+         which is published, and old heap is retired; caller holds
+         writer lock
+Function input/parameters: concurrent tree (ConcurrentTreeType *)
+Function output/parameters: concurrent tree, arena with room for text
+                            (ConcurrentTreeType *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: isEmpty, malloc, retireConcurrentItem
+*/
+void reserveConcurrentStringSpace( ConcurrentTreeType *treePtr );
+
+/*
+Name: retireConcurrentItem
+Process: adds old tree version or old string heap to end of retired
+         list at current epoch; caller holds writer lock
+Function input/parameters: concurrent tree (ConcurrentTreeType *),
+                           old root, may be NULL (AvlTreeNodeType *),
+                           old heap, may be NULL (char *)
+Function output/parameters: concurrent tree with item retired
+                            (ConcurrentTreeType *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: malloc, sizeof
+*/
+void retireConcurrentItem( ConcurrentTreeType *treePtr,
+                                 AvlTreeNodeType *rootPtr, char *heapPtr );
+
+/*
+Name: searchConcurrentTree
+Process: finds room in published tree and copies its data out, never
+         waits for writers: reader announces current epoch in its slot,
+         searches the root it finds, copies data, then leaves its slot,
+         so no node or text it reads is freed while it reads it;
+         reader id out of range finds nothing
+Function input/parameters: concurrent tree (ConcurrentTreeType *),
+                           reader id from addConcurrentReader (int),
+                           room number (const char *)
+Function output/parameters: room data, when found (RoomRecordType *)
+Function output/returned: Boolean result of search (bool)
+Device input/---: none
+Device output/---: none
+Dependencies: search, copyString, copyStringWithLimit, accessClassSetup
+*/
+bool searchConcurrentTree( ConcurrentTreeType *treePtr, int readerId,
+                        const char *roomNumber, RoomRecordType *recordPtr );
+
+/*
+Name: upsertConcurrentTree
+Process: updates or inserts room as upsert does in copy of published
+         tree, then publishes copy
+Function input/parameters: concurrent tree (ConcurrentTreeType *),
+                           room number, building room data, class setup
+                           (char *), capacity (int)
+Function output/parameters: none
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: pthread_mutex_lock, reserveConcurrentStringSpace, copyTree,
+              upsert, publishConcurrentRoot, pthread_mutex_unlock
+*/
+void upsertConcurrentTree( ConcurrentTreeType *treePtr,
+                     char *rmNmbr, char *bldgRm, char *clsSetup, int capacity );
+
+#endif   // CONCURRENT_TREE_UTILITY_H
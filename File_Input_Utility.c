@@ -10,6 +10,27 @@ non-commercial use as long as the above copyright statement is included.
 // header files
 #include "File_Input_Utility.h"
 #include <stdlib.h> //////////////////////////test
+#include <limits.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// wide delimiter scan when compiled for SSE2 or AVX2
+#if defined( __GNUC__ ) && defined( __AVX2__ )
+#include <immintrin.h>
+#define DELIMITER_SCAN_AVX2
+#define DELIMITER_SCAN_WIDTH 32
+#elif defined( __GNUC__ ) && defined( __SSE2__ )
+#include <emmintrin.h>
+#define DELIMITER_SCAN_SSE2
+#define DELIMITER_SCAN_WIDTH 16
+#endif
 
 // local global constants, used only in this file
 
@@ -34,37 +55,59 @@ non-commercial use as long as the above copyright statement is included.
     const int SET_INPUT_FLAG = 1001;
 
 
+    /*
+    Name: accessDefaultInputReader
+    process: provides reader used by functions without reader parameter;
+             note: reader is maintained (static) value initialized to
+             no file and end of file flag false
+    Function input/parameters: none
+    Function output/parameters: none
+    Function output/returned: pointer to default reader (InputFileReaderType *)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    InputFileReaderType *accessDefaultInputReader()
+       {
+        // initialize default reader to no file
+        static InputFileReaderType defaultReader = { NULL, false };
+
+        // return default reader
+        return &defaultReader;
+       }
+
     /*
     Name: accessEndOfInputFileFlag
     process: allows accessing or modifying end of file flag state;
-             note: flag is maintained (static) value initialized to false
+             note: flag is maintained in default reader, initialized to false
     Function input/parameters: control code (int), flag state (bool)
     Function output/parameters: none
     Function output/returned: result of flag state (bool)
     Device input/file: none
     Device output/monitor: none
-    Dependencies: none
+    Dependencies: accessDefaultInputReader
     */
     bool accessEndOfInputFileFlag( int ctrlCode, bool setFlag )
        {
-        // initialize end of file flag to false
-        static bool endOfFileFlag = false;
+        // get default reader
+           // function: accessDefaultInputReader
+        InputFileReaderType *readerPtr = accessDefaultInputReader();
 
         // test for set flag
         if( ctrlCode == SET_INPUT_FLAG )
            {
             // set flag to given state
-            endOfFileFlag = setFlag;
+            readerPtr->endOfFileFlag = setFlag;
            }
     
         // return flag state
-        return endOfFileFlag;
+        return readerPtr->endOfFileFlag;
        }
 
     /*
     Name: accessInputFilePointer
     process: allows setting or accessing file pointer;
-             note: pointer is maintained (static) value initialized to NULL
+             note: pointer is maintained in default reader, initialized to NULL
     Function input/parameters: control code (int), file pointer (FILE *)
                                DUMMY_INPUT_FILE_PTR used 
                                if not setting file pointer
@@ -72,22 +115,57 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: file pointer (FILE *)
     Device input/file: none
     Device output/monitor: none
-    Dependencies: none
+    Dependencies: accessDefaultInputReader
     */
     FILE *accessInputFilePointer( int ctrlCode, const FILE *filePtr )
        {
-        // initialize file pointer to null
-        static FILE *filePointer = NULL;
+        // get default reader
+           // function: accessDefaultInputReader
+        InputFileReaderType *readerPtr = accessDefaultInputReader();
 
         // check for set new pointer
         if( ctrlCode == SET_INPUT_FILE_PTR )
            {
             // set file pointer to parameter
-            filePointer = (FILE *)filePtr;
+            readerPtr->filePtr = (FILE *)filePtr;
            }
  
         // return file pointer
-        return filePointer;
+        return readerPtr->filePtr;
+       }
+
+    /*
+    Name: checkForBufferedReaderOpen
+    process: checks to see if file of buffered reader is currently open
+             returns true if file pointer not null, false otherwise
+    Function input/parameters: buffered reader (BufferedInputReaderType *)
+    Function output/parameters: none
+    Function output/returned: result of specified test (bool)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    bool checkForBufferedReaderOpen( BufferedInputReaderType *readerPtr )
+       {
+        // return test of reader file pointer
+        return readerPtr->filePtr != NULL;
+       }
+
+    /*
+    Name: checkForEndOfBufferedReader
+    process: checks to see if end of file flag has been encountered,
+             returns true if EOF has been encountered, false otherwise
+    Function input/parameters: buffered reader (BufferedInputReaderType *)
+    Function output/parameters: none
+    Function output/returned: result of specified test (bool)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    bool checkForEndOfBufferedReader( BufferedInputReaderType *readerPtr )
+       {
+        // return end of file flag of reader
+        return readerPtr->endOfFileFlag;
        }
 
     /*
@@ -99,13 +177,47 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: result of specified test (bool)
     Device input/file: none
     Device output/monitor: none
-    Dependencies: accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, checkForEndOfInputReader
     */
     bool checkForEndOfInputFile()
        {
-        // return access to end of file flag
-           // function: accessEndOfInputFileFlag
-        return accessEndOfInputFileFlag( GET_INPUT_FLAG, DUMMY_INPUT_FLAG );
+        // call reader version with default reader, return
+           // function: accessDefaultInputReader, checkForEndOfInputReader
+        return checkForEndOfInputReader( accessDefaultInputReader() );
+       }
+
+    /*
+    Name: checkForEndOfInputReader
+    process: checks to see if end of file flag has been encountered,
+             returns true if EOF has been encountered, false otherwise
+    Function input/parameters: reader (InputFileReaderType *)
+    Function output/parameters: none
+    Function output/returned: result of specified test (bool)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    bool checkForEndOfInputReader( InputFileReaderType *readerPtr )
+       {
+        // return end of file flag of reader
+        return readerPtr->endOfFileFlag;
+       }
+
+    /*
+    Name: checkForEndOfMappedFile
+    process: checks to see if all bytes of mapped file have been read,
+             returns true if at end of file, false otherwise
+    Function input/parameters: mapped file (const MappedInputFileType *)
+    Function output/parameters: none
+    Function output/returned: result of specified test (bool)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    bool checkForEndOfMappedFile( const MappedInputFileType *mappedFile )
+       {
+        // return test of position against file size
+        return mappedFile->position >= mappedFile->fileSize;
        }
 
     /*
@@ -117,14 +229,30 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: result of specified test (bool)
     Device input/file: none
     Device output/monitor: none
-    Dependencies: accessInputFilePointer
+    Dependencies: accessDefaultInputReader, checkForInputReaderOpen
     */
     bool checkForInputFileOpen()
        {
-        // return access to end of file flag
-           // function: accessInputFilePointer
-        return accessInputFilePointer( GET_INPUT_FLAG, 
-                                                 DUMMY_INPUT_FILE_PTR ) != NULL;
+        // call reader version with default reader, return
+           // function: accessDefaultInputReader, checkForInputReaderOpen
+        return checkForInputReaderOpen( accessDefaultInputReader() );
+       }
+
+    /*
+    Name: checkForInputReaderOpen
+    process: checks to see if file is currently open
+             returns true if file pointer not null, false otherwise
+    Function input/parameters: reader (InputFileReaderType *)
+    Function output/parameters: none
+    Function output/returned: result of specified test (bool)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    bool checkForInputReaderOpen( InputFileReaderType *readerPtr )
+       {
+        // return test of reader file pointer
+        return readerPtr->filePtr != NULL;
        }
 
     /*
@@ -167,6 +295,38 @@ non-commercial use as long as the above copyright statement is included.
         return (char)charInt;
        }
 
+    /*
+    Name: closeBufferedReader
+    process: closes file of buffered reader and releases its buffer,
+             returns true if successful, false otherwise
+    Function input/parameters: buffered reader (BufferedInputReaderType *)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: file closed
+    Device output/monitor: none
+    Dependencies: fclose, free
+    */
+    bool closeBufferedReader( BufferedInputReaderType *readerPtr )
+       {
+        // check for valid file pointer
+        if( readerPtr->filePtr != NULL )
+           {
+            // close file and release buffer
+               // function: fclose, free
+            fclose( readerPtr->filePtr );
+            free( readerPtr->bufferPtr );
+
+            // reset reader
+            initializeBufferedReader( readerPtr );
+
+            // return successful operation
+            return true;
+           }
+
+        // return failed operation
+        return false;
+       }
+
     /*
     Name: closeInputFile
     process: closes input file, returns true if successful, false otherwise
@@ -175,14 +335,29 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: none
     Device input/file: file closed
     Device output/monitor: none
-    Dependencies: accessInputFilePointer, fclose, accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, closeInputReader
     */
     bool closeInputFile()
+       {
+        // call reader version with default reader, return
+           // function: accessDefaultInputReader, closeInputReader
+        return closeInputReader( accessDefaultInputReader() );
+       }
+
+    /*
+    Name: closeInputReader
+    process: closes input file, returns true if successful, false otherwise
+    Function input/parameters: reader (InputFileReaderType *)
+    Function output/parameters: none
+    Function output/returned: none
+    Device input/file: file closed
+    Device output/monitor: none
+    Dependencies: fclose
+    */
+    bool closeInputReader( InputFileReaderType *readerPtr )
        {
         // set local file pointer to working file pointer
-           // function: accessInputFilePointer
-        FILE *filePtr = accessInputFilePointer( GET_INPUT_FILE_PTR, 
-                                                         DUMMY_INPUT_FILE_PTR );
+        FILE *filePtr = readerPtr->filePtr;
 
         // check for valid file pointer
         if( filePtr != NULL )
@@ -191,12 +366,10 @@ non-commercial use as long as the above copyright statement is included.
             fclose( filePtr );
 
             // set pointer to NULL
-               // function: accessInputFilePointer
-            accessInputFilePointer( SET_INPUT_FILE_PTR, NULL );
+            readerPtr->filePtr = NULL;
 
             // set end of file flag to false
-               // function: accessEndOfInputFileFlag
-            accessEndOfInputFileFlag( SET_INPUT_FLAG, false );
+            readerPtr->endOfFileFlag = false;
 
             // return successful operation
             return true;
@@ -206,6 +379,362 @@ non-commercial use as long as the above copyright statement is included.
         return false;
        }
 
+    /*
+    Name: closeMappedInputFile
+    process: unmaps and closes mapped input file, 
+             returns true if successful, false otherwise
+    Function input/parameters: mapped file (MappedInputFileType *)
+    Function output/parameters: mapped file cleared (MappedInputFileType *)
+    Function output/returned: success of operation (bool)
+    Device input/file: file closed
+    Device output/monitor: none
+    Dependencies: munmap, close (UnmapViewOfFile, CloseHandle on Windows)
+    */
+    bool closeMappedInputFile( MappedInputFileType *mappedFile )
+       {
+#ifdef _WIN32
+        // check for valid file handle
+        if( mappedFile->fileHandle == NULL )
+           {
+            // return failed operation
+            return false;
+           }
+
+        // check for mapped data, empty files are not mapped
+        if( mappedFile->dataPtr != NULL )
+           {
+            // unmap view and close mapping
+               // function: UnmapViewOfFile, CloseHandle
+            UnmapViewOfFile( mappedFile->dataPtr );
+            CloseHandle( mappedFile->mappingHandle );
+           }
+
+        // close file
+           // function: CloseHandle
+        CloseHandle( mappedFile->fileHandle );
+        mappedFile->fileHandle = NULL;
+        mappedFile->mappingHandle = NULL;
+#else
+        // check for valid file descriptor
+        if( mappedFile->fileDescriptor < 0 )
+           {
+            // return failed operation
+            return false;
+           }
+
+        // check for mapped data, empty files are not mapped
+        if( mappedFile->dataPtr != NULL )
+           {
+            // unmap file
+               // function: munmap
+            munmap( (void *)mappedFile->dataPtr, mappedFile->fileSize );
+           }
+
+        // close file
+           // function: close
+        close( mappedFile->fileDescriptor );
+        mappedFile->fileDescriptor = -1;
+#endif
+
+        // reset mapped data
+        mappedFile->dataPtr = NULL;
+        mappedFile->fileSize = 0;
+        mappedFile->position = 0;
+
+        // return successful operation
+        return true;
+       }
+
+    /*
+    Name: copyBytesToString
+    process: appends given number of bytes to captured string,
+             bytes that do not fit capacity are dropped,
+             string is not terminated
+    Function input/parameters: source bytes (const char *), 
+                               number of bytes (long), 
+                               current string length (int),
+                               capacity of captured string (int)
+    Function output/parameters: captured string (char *)
+    Function output/returned: new string length (int)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    int copyBytesToString( const char *sourcePtr, long numBytes, 
+                           char *capturedString, int index, int capacity )
+       {
+        // loop across bytes that fit
+        while( numBytes > 0 && index < capacity - 1 )
+           {
+            capturedString[ index ] = *sourcePtr;
+            index++;
+            sourcePtr++;
+            numBytes--;
+           }
+
+        // return new length
+        return index;
+       }
+
+    /*
+    Name: fillBufferedReader
+    process: replaces buffer contents with next block of file,
+             returns true if any data was read, false at end of file
+    Function input/parameters: buffered reader (BufferedInputReaderType *)
+    Function output/parameters: buffered reader with new data 
+                                (BufferedInputReaderType *)
+    Function output/returned: success of operation (bool)
+    Device input/file: block of data captured from file
+    Device output/monitor: none
+    Dependencies: fread
+    */
+    bool fillBufferedReader( BufferedInputReaderType *readerPtr )
+       {
+        // read next block
+           // function: fread
+        readerPtr->bufferCount = (int)fread( readerPtr->bufferPtr, 1, 
+                                      INPUT_BUFFER_SIZE, readerPtr->filePtr );
+        readerPtr->bufferPosition = 0;
+
+        // return whether data was found
+        return readerPtr->bufferCount > 0;
+       }
+
+    /*
+    Name: findNextDelimiter
+    process: finds first byte that matches any of three delimiters,
+             or is a control character (below space) if flag set;
+             compares 32 bytes at a time with AVX2 or 16 with SSE2
+             when compiled for them, otherwise one at a time
+    Function input/parameters: bytes to scan (const char *), 
+                               number of bytes (long),
+                               three delimiters (char), repeat one
+                               delimiter if fewer are needed,
+                               stop at control character flag (bool)
+    Function output/parameters: none
+    Function output/returned: offset of first stop byte, 
+                              number of bytes if none found (long)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: SSE2/AVX2 intrinsics when available, __builtin_ctz
+    */
+    long findNextDelimiter( const char *dataPtr, long numBytes, 
+                            char delimOne, char delimTwo, char delimThree,
+                            bool stopAtNonPrintable )
+       {
+        // initialize variables
+        long index = 0;
+        unsigned char testChar;
+#if defined( DELIMITER_SCAN_AVX2 )
+        __m256i chunk, matches;
+        __m256i oneSet = _mm256_set1_epi8( delimOne );
+        __m256i twoSet = _mm256_set1_epi8( delimTwo );
+        __m256i threeSet = _mm256_set1_epi8( delimThree );
+        __m256i controlLimit = _mm256_set1_epi8( SPACE - 1 );
+        unsigned int matchMask;
+
+        // compare 32 bytes at a time
+        while( index + DELIMITER_SCAN_WIDTH <= numBytes )
+           {
+            chunk = _mm256_loadu_si256( (const __m256i *)( dataPtr + index ) );
+
+            matches = _mm256_or_si256( 
+                           _mm256_or_si256( _mm256_cmpeq_epi8( chunk, oneSet ),
+                                         _mm256_cmpeq_epi8( chunk, twoSet ) ),
+                                       _mm256_cmpeq_epi8( chunk, threeSet ) );
+
+            // unsigned byte at most 31 is a control character
+            if( stopAtNonPrintable )
+               {
+                matches = _mm256_or_si256( matches, _mm256_cmpeq_epi8( 
+                                _mm256_max_epu8( chunk, controlLimit ), 
+                                                            controlLimit ) );
+               }
+
+            matchMask = (unsigned int)_mm256_movemask_epi8( matches );
+
+            // check for stop byte in chunk, return lowest one
+            if( matchMask != 0 )
+               {
+                return index + __builtin_ctz( matchMask );
+               }
+
+            index += DELIMITER_SCAN_WIDTH;
+           }
+#elif defined( DELIMITER_SCAN_SSE2 )
+        __m128i chunk, matches;
+        __m128i oneSet = _mm_set1_epi8( delimOne );
+        __m128i twoSet = _mm_set1_epi8( delimTwo );
+        __m128i threeSet = _mm_set1_epi8( delimThree );
+        __m128i controlLimit = _mm_set1_epi8( SPACE - 1 );
+        unsigned int matchMask;
+
+        // compare 16 bytes at a time
+        while( index + DELIMITER_SCAN_WIDTH <= numBytes )
+           {
+            chunk = _mm_loadu_si128( (const __m128i *)( dataPtr + index ) );
+
+            matches = _mm_or_si128( 
+                          _mm_or_si128( _mm_cmpeq_epi8( chunk, oneSet ),
+                                        _mm_cmpeq_epi8( chunk, twoSet ) ),
+                                      _mm_cmpeq_epi8( chunk, threeSet ) );
+
+            // unsigned byte at most 31 is a control character
+            if( stopAtNonPrintable )
+               {
+                matches = _mm_or_si128( matches, _mm_cmpeq_epi8( 
+                          _mm_max_epu8( chunk, controlLimit ), controlLimit ) );
+               }
+
+            matchMask = (unsigned int)_mm_movemask_epi8( matches );
+
+            // check for stop byte in chunk, return lowest one
+            if( matchMask != 0 )
+               {
+                return index + __builtin_ctz( matchMask );
+               }
+
+            index += DELIMITER_SCAN_WIDTH;
+           }
+#endif
+
+        // check remaining bytes one at a time
+        while( index < numBytes )
+           {
+            testChar = (unsigned char)dataPtr[ index ];
+
+            if( testChar == (unsigned char)delimOne 
+                || testChar == (unsigned char)delimTwo
+                || testChar == (unsigned char)delimThree 
+                || ( stopAtNonPrintable && testChar < SPACE ) )
+               {
+                return index;
+               }
+
+            index++;
+           }
+
+        // return no stop byte found
+        return numBytes;
+       }
+
+    /*
+    Name: getBufferedCharacter
+    process: takes next character from buffer, refilling as needed
+    Function input/parameters: buffered reader (BufferedInputReaderType *)
+    Function output/parameters: none
+    Function output/returned: character as unsigned value, EOF at end (int)
+    Device input/file: block of data captured from file as needed
+    Device output/monitor: none
+    Dependencies: fillBufferedReader
+    */
+    int getBufferedCharacter( BufferedInputReaderType *readerPtr )
+       {
+        // check for buffer used up and nothing left in file
+           // function: fillBufferedReader
+        if( readerPtr->bufferPosition == readerPtr->bufferCount
+                                        && !fillBufferedReader( readerPtr ) )
+           {
+            // return end of file
+            return EOF;
+           }
+
+        // return next character
+        readerPtr->bufferPosition++;
+        return (unsigned char)readerPtr->bufferPtr[ 
+                                              readerPtr->bufferPosition - 1 ];
+       }
+
+    /*
+    Name: initializeBufferedReader
+    process: sets buffered reader to no open file, no buffer,
+             and end of file flag false,
+             must be used before first open of a reader
+    Function input/parameters: none
+    Function output/parameters: initialized reader (BufferedInputReaderType *)
+    Function output/returned: none
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    void initializeBufferedReader( BufferedInputReaderType *readerPtr )
+       {
+        // set no file, empty buffer, and clear end of file flag
+        readerPtr->filePtr = NULL;
+        readerPtr->bufferPtr = NULL;
+        readerPtr->bufferCount = 0;
+        readerPtr->bufferPosition = 0;
+        readerPtr->endOfFileFlag = false;
+       }
+
+    /*
+    Name: initializeInputReader
+    process: sets reader to no open file and end of file flag false,
+             must be used before first open of a reader
+    Function input/parameters: none
+    Function output/parameters: initialized reader (InputFileReaderType *)
+    Function output/returned: none
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    void initializeInputReader( InputFileReaderType *readerPtr )
+       {
+        // set no file and clear end of file flag
+        readerPtr->filePtr = NULL;
+        readerPtr->endOfFileFlag = false;
+       }
+
+   /*
+    Name: openBufferedReader
+    process: opens input file for block reads and creates its buffer,
+             unsets end of file flag,
+             returns true if successful, false otherwise
+    Function input/parameters: buffered reader (BufferedInputReaderType *),
+                               file name (c-string)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: file opened
+    Device output/monitor: none
+    Dependencies: checkForBufferedReaderOpen, fopen, malloc
+    */
+    bool openBufferedReader( BufferedInputReaderType *readerPtr,
+                             const char *fileName )
+       {
+        // initialize variables
+        FILE *filePtr = NULL;
+        char readOnlyCharacter[] = "r";
+
+        // check for file not open
+           // function: checkForBufferedReaderOpen
+        if( !checkForBufferedReaderOpen( readerPtr ) )
+           {
+            // open file
+               // function: fopen
+            filePtr = fopen( fileName, readOnlyCharacter );
+
+            // check for success of file open
+            if( filePtr != NULL )
+               {
+                // set pointer and empty buffer in reader
+                   // function: malloc
+                readerPtr->filePtr = filePtr;
+                readerPtr->bufferPtr = (char *)malloc( INPUT_BUFFER_SIZE );
+                readerPtr->bufferCount = 0;
+                readerPtr->bufferPosition = 0;
+
+                // reset end of file flag, if needed
+                readerPtr->endOfFileFlag = false;
+
+                // return operation success
+                return true;
+               }
+           }
+
+        // return operation failure
+        return false;
+       }
+
    /*
     Name: openInputFile
     process: opens input file, sets file pointer and unsets end of file flag,
@@ -215,17 +744,37 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: success of operation (bool)
     Device input/file: file opened
     Device output/monitor: none
-    Dependencies: fopen, accessInputFilePointer, accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, openInputReader
     */
     bool openInputFile( const char *fileName )
+       {
+        // call reader version with default reader, return
+           // function: accessDefaultInputReader, openInputReader
+        return openInputReader( accessDefaultInputReader(), fileName );
+       }
+
+   /*
+    Name: openInputReader
+    process: opens input file, sets file pointer and unsets end of file flag,
+             returns true if successful, false otherwise
+    Function input/parameters: reader (InputFileReaderType *),
+                               file name (c-string)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: file opened
+    Device output/monitor: none
+    Dependencies: fopen
+    */
+    bool openInputReader( InputFileReaderType *readerPtr,
+                          const char *fileName )
        {
         // initialize variables
         FILE *filePtr = NULL;
         char readOnlyCharacter[] = "r";
 
         // check for file not open
-           // function: checkForInputFileOpen
-        if( !checkForInputFileOpen() )
+           // function: checkForInputReaderOpen
+        if( !checkForInputReaderOpen( readerPtr ) )
            {
             // open file
                // function: fopen
@@ -234,13 +783,11 @@ non-commercial use as long as the above copyright statement is included.
             // check for success of file open
             if( filePtr != NULL )
                {
-                // set pointer in access function
-                   // function: accessInputFilePointer
-                accessInputFilePointer( SET_INPUT_FILE_PTR, filePtr );
+                // set pointer in reader
+                readerPtr->filePtr = filePtr;
 
                 // reset end of file flag, if needed
-                   // accessEndOfInputFileFlag
-                accessEndOfInputFileFlag( SET_INPUT_FLAG, false );
+                readerPtr->endOfFileFlag = false;
 
                 // return operation success
                 return true;
@@ -251,6 +798,143 @@ non-commercial use as long as the above copyright statement is included.
         // return operation failure
         return false;
        }
+
+   /*
+    Name: openMappedInputFile
+    process: opens input file and maps whole file into memory read only,
+             sets read position to start of file,
+             returns true if successful, false otherwise
+    Function input/parameters: file name (c-string)
+    Function output/parameters: mapped file (MappedInputFileType *)
+    Function output/returned: success of operation (bool)
+    Device input/file: file opened and mapped
+    Device output/monitor: none
+    Dependencies: open, fstat, mmap, close 
+                  (CreateFileA, GetFileSizeEx, CreateFileMappingA, 
+                   MapViewOfFile, CloseHandle on Windows)
+    */
+    bool openMappedInputFile( MappedInputFileType *mappedFile, 
+                                                         const char *fileName )
+       {
+#ifdef _WIN32
+        // initialize variables
+        LARGE_INTEGER fileSize;
+#else
+        // initialize variables
+        struct stat fileStatus;
+        void *mapPtr;
+#endif
+
+        // start with nothing mapped
+        mappedFile->dataPtr = NULL;
+        mappedFile->fileSize = 0;
+        mappedFile->position = 0;
+
+#ifdef _WIN32
+        // open file
+           // function: CreateFileA
+        mappedFile->fileHandle = CreateFileA( fileName, GENERIC_READ, 
+                                   FILE_SHARE_READ, NULL, OPEN_EXISTING, 
+                                   FILE_FLAG_SEQUENTIAL_SCAN, NULL );
+        mappedFile->mappingHandle = NULL;
+
+        // check for failed open or size
+           // function: GetFileSizeEx
+        if( mappedFile->fileHandle == INVALID_HANDLE_VALUE
+                     || !GetFileSizeEx( mappedFile->fileHandle, &fileSize ) )
+           {
+            // close file if opened, return operation failure
+            if( mappedFile->fileHandle != INVALID_HANDLE_VALUE )
+               {
+                CloseHandle( mappedFile->fileHandle );
+               }
+
+            mappedFile->fileHandle = NULL;
+            return false;
+           }
+
+        mappedFile->fileSize = (long)fileSize.QuadPart;
+
+        // check for data to map, empty files cannot be mapped
+        if( mappedFile->fileSize > 0 )
+           {
+            // create mapping and view of whole file
+               // function: CreateFileMappingA, MapViewOfFile
+            mappedFile->mappingHandle = CreateFileMappingA( 
+                   mappedFile->fileHandle, NULL, PAGE_READONLY, 0, 0, NULL );
+
+            if( mappedFile->mappingHandle != NULL )
+               {
+                mappedFile->dataPtr = (const char *)MapViewOfFile( 
+                      mappedFile->mappingHandle, FILE_MAP_READ, 0, 0, 0 );
+               }
+
+            // check for failed mapping
+            if( mappedFile->dataPtr == NULL )
+               {
+                // close handles, return operation failure
+                if( mappedFile->mappingHandle != NULL )
+                   {
+                    CloseHandle( mappedFile->mappingHandle );
+                   }
+
+                CloseHandle( mappedFile->fileHandle );
+                mappedFile->fileHandle = NULL;
+                mappedFile->fileSize = 0;
+                return false;
+               }
+           }
+#else
+        // open file
+           // function: open
+        mappedFile->fileDescriptor = open( fileName, O_RDONLY );
+
+        // check for failed open or size
+           // function: fstat
+        if( mappedFile->fileDescriptor < 0 
+                     || fstat( mappedFile->fileDescriptor, &fileStatus ) != 0 )
+           {
+            // close file if opened, return operation failure
+            if( mappedFile->fileDescriptor >= 0 )
+               {
+                close( mappedFile->fileDescriptor );
+               }
+
+            mappedFile->fileDescriptor = -1;
+            return false;
+           }
+
+        mappedFile->fileSize = (long)fileStatus.st_size;
+
+        // check for data to map, empty files cannot be mapped
+        if( mappedFile->fileSize > 0 )
+           {
+            // map whole file read only
+               // function: mmap
+            mapPtr = mmap( NULL, mappedFile->fileSize, PROT_READ, MAP_PRIVATE,
+                                            mappedFile->fileDescriptor, 0 );
+
+            // check for failed mapping
+            if( mapPtr == MAP_FAILED )
+               {
+                // close file, return operation failure
+                close( mappedFile->fileDescriptor );
+                mappedFile->fileDescriptor = -1;
+                mappedFile->fileSize = 0;
+                return false;
+               }
+
+            // file is read front to back once
+               // function: madvise
+            madvise( mapPtr, mappedFile->fileSize, MADV_SEQUENTIAL );
+
+            mappedFile->dataPtr = (const char *)mapPtr;
+           }
+#endif
+
+        // return operation success
+        return true;
+       }
     
     /*
     Name: readCharacterFromFile
@@ -261,65 +945,282 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: character found if successful, ZERO_CHAR otherwise
     Device input/file: character(s) captured from file as needed
     Device output/monitor: none
-    Dependencies: readCharacterFromFileConfigured
+    Dependencies: accessDefaultInputReader, readCharacterFromReader
     */
     char readCharacterFromFile()
+       {
+        // call reader version with default reader, return
+           // function: accessDefaultInputReader, readCharacterFromReader
+        return readCharacterFromReader( accessDefaultInputReader() );
+       }
+
+    /*
+    Name: readCharacterFromReader
+    process: ignores leading unprintable characters, including space,
+             captures first printable character
+    Function input/parameters: reader (InputFileReaderType *)
+    Function output/parameters: none
+    Function output/returned: character found if successful, ZERO_CHAR otherwise
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: readCharacterFromReaderConfigured
+    */
+    char readCharacterFromReader( InputFileReaderType *readerPtr )
        {
         // initialize parameter to not allow space
         bool noSpaceCapture = false;
 
-        // capture character, return
-           // function: getCharFromFileConfigured
-        return readCharacterFromFileConfigured( noSpaceCapture );
+        // capture character, return
+           // function: getCharFromFileConfigured
+        return readCharacterFromReaderConfigured( readerPtr, noSpaceCapture );
+       }
+
+    /*
+    Name: readCharacterFromFileConfigured
+    process: ignores leading unprintable characters,
+             captures first printable character,
+             including space if allowed
+    Function input/parameters: allow space capture (bool)
+    Function output/parameters: none
+    Function output/returned: character found if successful, ZERO_CHAR otherwise
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: accessDefaultInputReader, readCharacterFromReaderConfigured
+    */
+    char readCharacterFromFileConfigured( bool captureSpace )
+       {
+        // call reader version with default reader, return
+           // function: accessDefaultInputReader, 
+           //           readCharacterFromReaderConfigured
+        return readCharacterFromReaderConfigured( accessDefaultInputReader(),
+                                                  captureSpace );
+       }
+
+    /*
+    Name: readCharacterFromReaderConfigured
+    process: ignores leading unprintable characters,
+             captures first printable character,
+             including space if allowed
+    Function input/parameters: reader (InputFileReaderType *),
+                               allow space capture (bool)
+    Function output/parameters: none
+    Function output/returned: character found if successful, ZERO_CHAR otherwise
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: checkForInputReaderOpen, checkForEndOfInputReader,
+                  clearLeadingWhiteSpace
+    */
+    char readCharacterFromReaderConfigured( InputFileReaderType *readerPtr,
+                                            bool captureSpace )
+       {
+        // initialize variables
+        FILE *filePtr;
+        int intChar = ZERO_CHAR;
+
+        // check for file open and data accessible
+           // function: checkForInputReaderOpen, checkForEndOfInputReader
+        if( checkForInputReaderOpen( readerPtr ) 
+                                   && !checkForEndOfInputReader( readerPtr ) )
+           {
+            // set file pointer
+            filePtr = readerPtr->filePtr;
+
+            // get character
+               // function: clearLeadingWhiteSpace
+            intChar = clearLeadingWhiteSpace( filePtr, !captureSpace );
+
+            // check for end of file found
+            if( intChar == EOF )
+               {
+                // set end of file flag
+                readerPtr->endOfFileFlag = true;
+
+                // set return value to zero
+                intChar = ZERO_CHAR;
+               }
+           }
+
+        // return value as character
+        return intChar;
+       }
+
+    /*
+    Name: readCsvFieldFromMappedFile
+    process: ignores leading spaces, captures one comma separated field
+             directly from mapped bytes, including quoted fields
+             with embedded commas and doubled quotes,
+             stops at comma, end of line (LF or CRLF), or end of file
+             and consumes it, field is truncated to fit capacity
+    Function input/parameters: mapped file (MappedInputFileType *),
+                               capacity of captured string (int)
+    Function output/parameters: captured string (char *), EMPTY_STRING 
+                                otherwise, end of record flag (bool *)
+    Function output/returned: success of operation, false if at end of file
+    Device input/file: none, file is already mapped
+    Device output/monitor: none
+    Dependencies: findNextDelimiter, copyBytesToString
+    */
+    bool readCsvFieldFromMappedFile( MappedInputFileType *mappedFile,
+                                     char *capturedString, int capacity, 
+                                     bool *endOfRecord )
+       {
+        // initialize variables
+        const char *dataPtr = mappedFile->dataPtr;
+        long position = mappedFile->position;
+        long fileSize = mappedFile->fileSize;
+        long spanLength;
+        int index = 0;
+
+        // initialize output string and flag
+        capturedString[ index ] = NULL_CHAR;
+        *endOfRecord = true;
+
+        // check for data accessible
+        if( position >= fileSize )
+           {
+            // return failed operation
+            return false;
+           }
+
+        // clear leading spaces
+        while( position < fileSize && dataPtr[ position ] == SPACE )
+           {
+            position++;
+           }
+
+        // check for quoted field
+        if( position < fileSize && dataPtr[ position ] == QUOTE )
+           {
+            // skip opening quote
+            position++;
+
+            // loop to closing quote
+            while( position < fileSize )
+               {
+                // capture quoted data up to next quote
+                   // function: findNextDelimiter, copyBytesToString
+                spanLength = findNextDelimiter( dataPtr + position, 
+                        fileSize - position, QUOTE, QUOTE, QUOTE, false );
+                index = copyBytesToString( dataPtr + position, spanLength, 
+                                            capturedString, index, capacity );
+                position += spanLength;
+
+                // check for no closing quote
+                if( position >= fileSize )
+                   {
+                    break;
+                   }
+
+                // skip quote
+                position++;
+
+                // check for closing quote, doubled quote is kept
+                if( position >= fileSize || dataPtr[ position ] != QUOTE )
+                   {
+                    break;
+                   }
+
+                index = copyBytesToString( dataPtr + position, 1, 
+                                            capturedString, index, capacity );
+                position++;
+               }
+           }
+
+        // capture unquoted data up to delimiter or line end
+           // function: findNextDelimiter, copyBytesToString
+        spanLength = findNextDelimiter( dataPtr + position, fileSize - position,
+                           COMMA, NEWLINE_CHAR, CARRIAGE_RETURN_CHAR, false );
+        index = copyBytesToString( dataPtr + position, spanLength, 
+                                            capturedString, index, capacity );
+        position += spanLength;
+
+        // set end of c-string
+        capturedString[ index ] = NULL_CHAR;
+
+        // check for comma, more fields follow
+        if( position < fileSize && dataPtr[ position ] == COMMA )
+           {
+            *endOfRecord = false;
+            position++;
+           }
+
+        // otherwise, check for line end, consume CR LF pair
+        else if( position < fileSize )
+           {
+            if( dataPtr[ position ] == CARRIAGE_RETURN_CHAR )
+               {
+                position++;
+               }
+
+            if( position < fileSize && dataPtr[ position ] == NEWLINE_CHAR )
+               {
+                position++;
+               }
+           }
+
+        // update read position
+        mappedFile->position = position;
+
+        // return successful operation
+        return true;
        }
 
     /*
-    Name: readCharacterFromFileConfigured
-    process: ignores leading unprintable characters,
-             captures first printable character,
-             including space if allowed
-    Function input/parameters: allow space capture (bool)
-    Function output/parameters: none
-    Function output/returned: character found if successful, ZERO_CHAR otherwise
-    Device input/file: character(s) captured from file as needed
+    Name: readCsvIntegerFromMappedFile
+    process: captures one comma separated field as a signed integer
+             directly from mapped bytes, ignores surrounding spaces,
+             stops at comma, end of line, or end of file and consumes it;
+             value too large for int is clamped to INT_MAX
+    Function input/parameters: mapped file (MappedInputFileType *)
+    Function output/parameters: end of record flag (bool *)
+    Function output/returned: integer found if successful, ZERO_VALUE otherwise
+    Device input/file: none, file is already mapped
     Device output/monitor: none
-    Dependencies: checkForInputFileOpen, checkForEndOfInputFile, 
-                  accessInputFilePointer, clearLeadingWhiteSpace, 
-                  accessEndOfInputFileFlag
+    Dependencies: readCsvFieldFromMappedFile
     */
-    char readCharacterFromFileConfigured( bool captureSpace )
+    int readCsvIntegerFromMappedFile( MappedInputFileType *mappedFile, 
+                                                            bool *endOfRecord )
        {
         // initialize variables
-        FILE *filePtr;
-        int intChar = ZERO_CHAR;
+        char fieldStr[ MIN_STR_LEN ];
+        int index = 0, digit, intVal = ZERO_VALUE;
+        bool isNegative = false;
+
+        // capture field
+           // function: readCsvFieldFromMappedFile
+        if( !readCsvFieldFromMappedFile( mappedFile, fieldStr, 
+                                                    MIN_STR_LEN, endOfRecord ) )
+           {
+            // return zero for no data
+            return ZERO_VALUE;
+           }
 
-        // check for file open and data accessible
-           // function: checkForInputFileOpen, checkForEndOfInputFile
-        if( checkForInputFileOpen() && !checkForEndOfInputFile() )
+        // check for sign
+        if( fieldStr[ index ] == DASH || fieldStr[ index ] == PLUS )
            {
-            // set file pointer
-               // function: accessInputFilePointer
-            filePtr = accessInputFilePointer( GET_INPUT_FILE_PTR, 
-                                                         DUMMY_INPUT_FILE_PTR );
+            isNegative = fieldStr[ index ] == DASH;
+            index++;
+           }
 
-            // get character
-               // function: clearLeadingWhiteSpace
-            intChar = clearLeadingWhiteSpace( filePtr, !captureSpace );
+        // accumulate digits
+        while( fieldStr[ index ] >= '0' && fieldStr[ index ] <= '9' )
+           {
+            digit = fieldStr[ index ] - '0';
 
-            // check for end of file found
-            if( intChar == EOF )
+            // check for value that would pass INT_MAX, clamp and stop
+            if( intVal > ( INT_MAX - digit ) / 10 )
                {
-                // set end of file flag
-                   // function: accessEndOfInputFileFlag
-                accessEndOfInputFileFlag( SET_INPUT_FLAG, true );
+                intVal = INT_MAX;
 
-                // set return value to zero
-                intChar = ZERO_CHAR;
+                break;
                }
+
+            intVal = intVal * 10 + digit;
+            index++;
            }
 
-        // return value as character
-        return intChar;
+        // return acquired value
+        return isNegative ? -intVal : intVal;
        }
 
     /*
@@ -331,10 +1232,27 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: double value found if successful (double)
     Device input/file: double value captured from file
     Device output/monitor: none
-    Dependencies: checkForInputFileOpen, checkForEndOfInputFile, 
-                  accessInputFilePointer, fscanf, accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, readDoubleFromReader
     */
     double readDoubleFromFile()
+       {
+        // call reader version with default reader, return
+           // function: accessDefaultInputReader, readDoubleFromReader
+        return readDoubleFromReader( accessDefaultInputReader() );
+       }
+
+    /*
+    Name: readDoubleFromReader
+    process: ignores leading unprintable characters,
+             captures first contiguous double value
+    Function input/parameters: reader (InputFileReaderType *)
+    Function output/parameters: none
+    Function output/returned: double value found if successful (double)
+    Device input/file: double value captured from file
+    Device output/monitor: none
+    Dependencies: checkForInputReaderOpen, checkForEndOfInputReader, fscanf
+    */
+    double readDoubleFromReader( InputFileReaderType *readerPtr )
        {
         // initialize variables
         FILE *filePtr = NULL;
@@ -342,13 +1260,12 @@ non-commercial use as long as the above copyright statement is included.
         double doubleVal = ZERO_VALUE;
 
         // check for file open and data accessible
-           // function: checkForInputFileOpen, checkForEndOfInputFile
-        if( checkForInputFileOpen() && !checkForEndOfInputFile() )
+           // function: checkForInputReaderOpen, checkForEndOfInputReader
+        if( checkForInputReaderOpen( readerPtr ) 
+                                   && !checkForEndOfInputReader( readerPtr ) )
            {
             // set file pointer
-               // function: accessInputFilePointer
-            filePtr = accessInputFilePointer( GET_INPUT_FILE_PTR, 
-                                                         DUMMY_INPUT_FILE_PTR );
+            filePtr = readerPtr->filePtr;
 
             // get double value
                // function: fscanf
@@ -358,8 +1275,7 @@ non-commercial use as long as the above copyright statement is included.
             if( fscanfReturn == EOF )
                {
                 // set end of file flag
-                   // function: accessEndOfInputFileFlag
-                accessEndOfInputFileFlag( SET_INPUT_FLAG, true );
+                readerPtr->endOfFileFlag = true;
 
                 // set return value to zero
                 doubleVal = ZERO_VALUE;
@@ -379,10 +1295,27 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: integer found if successful, ZERO_VALUE otherwise
     Device input/file: character(s) captured from file as needed
     Device output/monitor: none
-    Dependencies: checkForInputFileOpen, checkForEndOfInputFile, 
-                  accessInputFilePointer, fscanf, accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, readIntegerFromReader
     */
     int readIntegerFromFile()
+       {
+        // call reader version with default reader, return
+           // function: accessDefaultInputReader, readIntegerFromReader
+        return readIntegerFromReader( accessDefaultInputReader() );
+       }
+
+    /*
+    Name: readIntegerFromReader
+    process: ignores leading unprintable characters,
+             captures first contiguous integer
+    Function input/parameters: reader (InputFileReaderType *)
+    Function output/parameters: none
+    Function output/returned: integer found if successful, ZERO_VALUE otherwise
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: checkForInputReaderOpen, checkForEndOfInputReader, fscanf
+    */
+    int readIntegerFromReader( InputFileReaderType *readerPtr )
        {
         // initialize variables
         FILE *filePtr = NULL;
@@ -390,13 +1323,12 @@ non-commercial use as long as the above copyright statement is included.
         int intVal = ZERO_VALUE;
 
         // check for file open and data accessible
-           // function: checkForInputFileOpen, checkForEndOfInputFile
-        if( checkForInputFileOpen() && !checkForEndOfInputFile() )
+           // function: checkForInputReaderOpen, checkForEndOfInputReader
+        if( checkForInputReaderOpen( readerPtr ) 
+                                   && !checkForEndOfInputReader( readerPtr ) )
            {
             // set file pointer
-               // function: accessInputFilePointer
-            filePtr = accessInputFilePointer( GET_INPUT_FILE_PTR, 
-                                                         DUMMY_INPUT_FILE_PTR );
+            filePtr = readerPtr->filePtr;
 
             // get integer value
                // function: fscanf
@@ -406,8 +1338,7 @@ non-commercial use as long as the above copyright statement is included.
             if( fscanfReturn == EOF )
                {
                 // set end of file flag
-                   // function: accessEndOfInputFileFlag
-                accessEndOfInputFileFlag( SET_INPUT_FLAG, true );
+                readerPtr->endOfFileFlag = true;
 
                 // set return value to zero
                 intVal = ZERO_VALUE;
@@ -428,10 +1359,28 @@ non-commercial use as long as the above copyright statement is included.
                               ZERO_VALUE otherwise
     Device input/file: long value captured from file
     Device output/monitor: none
-    Dependencies: checkForInputFileOpen, checkForEndOfInputFile, 
-                  accessInputFilePointer, fscanf, accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, readLongFromReader
     */
     long readLongFromFile()
+       {
+        // call reader version with default reader, return
+           // function: accessDefaultInputReader, readLongFromReader
+        return readLongFromReader( accessDefaultInputReader() );
+       }
+
+    /*
+    Name: readLongFromReader
+    process: ignores leading unprintable characters,
+             captures first contiguous long int
+    Function input/parameters: reader (InputFileReaderType *)
+    Function output/parameters: none
+    Function output/returned: long integer found if successful, 
+                              ZERO_VALUE otherwise
+    Device input/file: long value captured from file
+    Device output/monitor: none
+    Dependencies: checkForInputReaderOpen, checkForEndOfInputReader, fscanf
+    */
+    long readLongFromReader( InputFileReaderType *readerPtr )
        {
         // initialize variables
         FILE *filePtr = NULL;
@@ -439,13 +1388,12 @@ non-commercial use as long as the above copyright statement is included.
         long longVal = ZERO_VALUE;
 
         // check for file open and data accessible
-           // function: checkForInputFileOpen, checkForEndOfInputFile
-        if( checkForInputFileOpen() && !checkForEndOfInputFile() )
+           // function: checkForInputReaderOpen, checkForEndOfInputReader
+        if( checkForInputReaderOpen( readerPtr ) 
+                                   && !checkForEndOfInputReader( readerPtr ) )
            {
             // set file pointer
-               // function: accessInputFilePointer
-            filePtr = accessInputFilePointer( GET_INPUT_FILE_PTR, 
-                                                         DUMMY_INPUT_FILE_PTR );
+            filePtr = readerPtr->filePtr;
 
             // get long value
                // function: fscanf
@@ -455,8 +1403,7 @@ non-commercial use as long as the above copyright statement is included.
             if( fscanfReturn == EOF )
                {
                 // set end of file flag
-                   // function: accessEndOfInputFileFlag
-                accessEndOfInputFileFlag( SET_INPUT_FLAG, true );
+                readerPtr->endOfFileFlag = true;
 
                 // set return value to zero
                 longVal = ZERO_VALUE;
@@ -475,23 +1422,38 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: character found if successful, ZERO_CHAR otherwise
     Device input/file: character captured from file
     Device output/monitor: none
-    Dependencies: checkForInputFileOpen, checkForEndOfInputFile, 
-                  accessInputFilePointer, fgetc, accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, readRawCharFromReader
     */
     char readRawCharFromFile()
+       {
+        // call reader version with default reader, return
+           // function: accessDefaultInputReader, readRawCharFromReader
+        return readRawCharFromReader( accessDefaultInputReader() );
+       }
+
+    /*
+    Name: readRawCharFromReader
+    process: captures first character in file stream including non-printable
+    Function input/parameters: reader (InputFileReaderType *)
+    Function output/parameters: none
+    Function output/returned: character found if successful, ZERO_CHAR otherwise
+    Device input/file: character captured from file
+    Device output/monitor: none
+    Dependencies: checkForInputReaderOpen, checkForEndOfInputReader, fgetc
+    */
+    char readRawCharFromReader( InputFileReaderType *readerPtr )
        {
         // initialize variables
         FILE *filePtr = NULL;
         int intChar = (int)ZERO_CHAR;
 
         // check for file open and data accessible
-           // function: checkForInputFileOpen, checkForEndOfInputFile
-        if( checkForInputFileOpen() && !checkForEndOfInputFile() )
+           // function: checkForInputReaderOpen, checkForEndOfInputReader
+        if( checkForInputReaderOpen( readerPtr ) 
+                                   && !checkForEndOfInputReader( readerPtr ) )
            {
             // set file pointer
-               // function: accessInputFilePointer
-            filePtr = accessInputFilePointer( GET_INPUT_FILE_PTR, 
-                                                         DUMMY_INPUT_FILE_PTR );
+            filePtr = readerPtr->filePtr;
 
             // get character
                // function: fgetc
@@ -501,8 +1463,7 @@ non-commercial use as long as the above copyright statement is included.
             if( intChar == EOF )
                {
                 // set end of file flag
-                   // function: accessEndOfInputFileFlag
-                accessEndOfInputFileFlag( SET_INPUT_FLAG, true );
+                readerPtr->endOfFileFlag = true;
 
                 // set return value to zero
                 intChar = (int)ZERO_CHAR;
@@ -513,6 +1474,136 @@ non-commercial use as long as the above copyright statement is included.
         return (char)intChar;
        }
 
+    /*
+    Name: readStringConfiguredFromBufferedReader
+    Process: captures string with same options and results 
+             as readStringConfiguredFromReader:
+             - clear leading non printable (bool)
+             - clear leading space character (bool)
+             - adquires characters up to any non-printable (bool)
+             - adquires characters up to any printable delimiter (char)
+               - use constant NON_PRINTABLE if no delimiter
+             - also stops capture when full (MAX_STR_LEN)
+             characters of field are found with block scan of buffer
+             rather than one at a time
+             Note: This function consumes the last character input,
+             including the space, delimiter, or non-printable character
+    Function input/parameters: buffered reader (BufferedInputReaderType *),
+                               see process above
+    Function output/parameters: captured string (char *), EMPTY_STRING otherwise
+    Function output/returned: success of operation (bool)
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: checkForBufferedReaderOpen, checkForEndOfBufferedReader,
+                  getBufferedCharacter, fillBufferedReader, 
+                  findNextDelimiter, copyBytesToString
+    */
+    bool readStringConfiguredFromBufferedReader( 
+                                      BufferedInputReaderType *readerPtr,
+                                      bool clearLeadingNonPrintable, 
+                                      bool clearLeadingSpace, 
+                                      bool stopAtNonPrintable, 
+                                      char delimiter,
+                                      char *capturedString )
+       {
+        // initialize variables
+        int intChar = EOF, index = 0;
+        long scanLength, spanLength;
+
+        // initialize output string
+        capturedString[ index ] = NULL_CHAR;
+
+        // check for file open and data accessible
+           // function: checkForBufferedReaderOpen, 
+           //           checkForEndOfBufferedReader
+        if( !checkForBufferedReaderOpen( readerPtr ) 
+                                 || checkForEndOfBufferedReader( readerPtr ) )
+           {
+            // return failed operation
+            return false;
+           }
+
+        // get first character
+           // function: getBufferedCharacter
+        intChar = getBufferedCharacter( readerPtr );
+
+        // loop while leading characters are to be cleared
+        while( intChar != EOF 
+               && ( ( clearLeadingNonPrintable && intChar < SPACE )
+                    || ( clearLeadingSpace && intChar == SPACE ) ) )
+           {
+            intChar = getBufferedCharacter( readerPtr );
+           }
+
+        // check for end of file found
+        if( intChar == EOF )
+           {
+            // set end of file flag
+            readerPtr->endOfFileFlag = true;
+
+            // return failed operation
+            return false;
+           }
+
+        // first character is still in buffer, scan from it
+        readerPtr->bufferPosition--;
+
+        // loop while room in string
+        while( index < MAX_STR_LEN - 1 )
+           {
+            // check for buffer used up and nothing left in file
+               // function: fillBufferedReader
+            if( readerPtr->bufferPosition == readerPtr->bufferCount
+                                        && !fillBufferedReader( readerPtr ) )
+               {
+                // field ends at end of file
+                capturedString[ index ] = NULL_CHAR;
+
+                return true;
+               }
+
+            // find stop character in buffered data that fits string
+               // function: findNextDelimiter
+            scanLength = readerPtr->bufferCount - readerPtr->bufferPosition;
+
+            if( scanLength > MAX_STR_LEN - 1 - index )
+               {
+                scanLength = MAX_STR_LEN - 1 - index;
+               }
+
+            spanLength = findNextDelimiter( 
+                   readerPtr->bufferPtr + readerPtr->bufferPosition, 
+                   scanLength, delimiter, delimiter, delimiter, 
+                                                        stopAtNonPrintable );
+
+            // capture characters ahead of stop character
+               // function: copyBytesToString
+            index = copyBytesToString( 
+                        readerPtr->bufferPtr + readerPtr->bufferPosition,
+                               spanLength, capturedString, index, MAX_STR_LEN );
+            readerPtr->bufferPosition += (int)spanLength;
+
+            // check for stop character found, consume it
+            if( spanLength < scanLength )
+               {
+                readerPtr->bufferPosition++;
+
+                capturedString[ index ] = NULL_CHAR;
+
+                return true;
+               }
+           }
+
+        // string is full, next character is consumed as by other readers
+           // function: getBufferedCharacter
+        getBufferedCharacter( readerPtr );
+
+        capturedString[ index ] = NULL_CHAR;
+
+        // return successful operation
+        return true;
+       }
+
     /*
     Name: readStringConfiguredFromFile
     Process: captures string with options:
@@ -529,14 +1620,50 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: success of operation (bool)
     Device input/file: character(s) captured from file as needed
     Device output/monitor: none
-    Dependencies: checkForInputFileOpen, checkForEndOfInputFile, 
-                  clearLeadingWhiteSpace, fgetc, accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, readStringConfiguredFromReader
     */
    bool readStringConfiguredFromFile( bool clearLeadingNonPrintable, 
                                       bool clearLeadingSpace, 
                                       bool stopAtNonPrintable, 
                                       char delimiter,
                                       char *capturedString )
+       {
+        // call reader version with default reader, return
+           // function: accessDefaultInputReader, readStringConfiguredFromReader
+        return readStringConfiguredFromReader( accessDefaultInputReader(),
+                                               clearLeadingNonPrintable, 
+                                               clearLeadingSpace, 
+                                               stopAtNonPrintable, 
+                                               delimiter,
+                                               capturedString );
+       }
+
+    /*
+    Name: readStringConfiguredFromReader
+    Process: captures string with options:
+             - clear leading non printable (bool)
+             - clear leading space character (bool)
+             - adquires characters up to any non-printable (bool)
+             - adquires characters up to any printable delimiter (char)
+               - use constant NON_PRINTABLE if no delimiter
+             - also stops capture when full (MAX_STR_LEN)
+             Note: This function consumes the last character input,
+             including the space, delimiter, or non-printable character
+    Function input/parameters: reader (InputFileReaderType *),
+                               see process above
+    Function output/parameters: captured string (char *), EMPTY_STRING otherwise
+    Function output/returned: success of operation (bool)
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: checkForInputReaderOpen, checkForEndOfInputReader,
+                  clearLeadingWhiteSpace, fgetc
+    */
+   bool readStringConfiguredFromReader( InputFileReaderType *readerPtr,
+                                      bool clearLeadingNonPrintable, 
+                                      bool clearLeadingSpace, 
+                                      bool stopAtNonPrintable, 
+                                      char delimiter,
+                                      char *capturedString )
       {
        // initialize variables
        int intChar = EOF, index = 0;
@@ -546,13 +1673,12 @@ non-commercial use as long as the above copyright statement is included.
         capturedString[ index ] = NULL_CHAR;
 
         // check for file open and data accessible
-           // function: checkForInputFileOpen, checkForEndOfInputFile
-       if( checkForInputFileOpen() && !checkForEndOfInputFile() )
+           // function: checkForInputReaderOpen, checkForEndOfInputReader
+       if( checkForInputReaderOpen( readerPtr ) 
+                                   && !checkForEndOfInputReader( readerPtr ) )
           {
            // get file pointer
-              // function: accessFilePtr
-           filePtr = accessInputFilePointer( GET_INPUT_FILE_PTR, 
-                                                         DUMMY_INPUT_FILE_PTR );
+           filePtr = readerPtr->filePtr;
 
            // check for clearing non printable
            if( clearLeadingNonPrintable )
@@ -586,8 +1712,7 @@ non-commercial use as long as the above copyright statement is included.
             if( intChar == EOF )
                {
                 // set end of file flag
-                   // function: accessEndOfInputFileFlag
-                accessEndOfInputFileFlag( SET_INPUT_FLAG, true );
+                readerPtr->endOfFileFlag = true;
 
                 // return failed operation
                 return false;
@@ -642,9 +1767,30 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: success of operation (bool)
     Device input/file: character(s) captured from file as needed
     Device output/monitor: none
-    Dependencies: readStringConfigured with appropriate parameters
+    Dependencies: accessDefaultInputReader, readStringSegmentFromReader
     */
     bool readStringSegmentFromFile( char *capturedString )
+       {
+        // call reader version with default reader, return
+           // function: accessDefaultInputReader, readStringSegmentFromReader
+        return readStringSegmentFromReader( accessDefaultInputReader(),
+                                            capturedString );
+       }
+
+   /*
+    Name: readStringSegmentFromReader
+    process: ignores leading white space, including space character,
+             captures series of characters up to first space,
+             or end of line, or full string
+    Function input/parameters: reader (InputFileReaderType *)
+    Function output/parameters: captured string (char *), EMPTY_STRING otherwise
+    Function output/returned: success of operation (bool)
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: readStringConfiguredFromReader with appropriate parameters
+    */
+    bool readStringSegmentFromReader( InputFileReaderType *readerPtr,
+                                      char *capturedString )
        {
         // initialize variables
         bool clearLeadingNonPrintable = true;
@@ -653,11 +1799,44 @@ non-commercial use as long as the above copyright statement is included.
         char delimiter = SPACE;
 
         // call utility function, return
-        return readStringConfiguredFromFile( clearLeadingNonPrintable, 
-                                             clearLeadingSpace, 
-                                             stopAtNonPrintable, 
-                                             delimiter,
-                                             capturedString );
+        return readStringConfiguredFromReader( readerPtr,
+                                               clearLeadingNonPrintable, 
+                                               clearLeadingSpace, 
+                                               stopAtNonPrintable, 
+                                                 delimiter,
+                                               capturedString );
+       }
+
+   /*
+    Name: readStringToLineEndFromBufferedReader
+    process: ignores leading white space, including space character,
+             captures series of characters up to end of current line
+             or full string, using block scan of buffer
+    Function input/parameters: buffered reader (BufferedInputReaderType *)
+    Function output/parameters: captured string (char *), EMPTY_STRING otherwise
+    Function output/returned: string found if successful
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: readStringConfiguredFromBufferedReader 
+                  with appropriate parameters
+    */
+    bool readStringToLineEndFromBufferedReader( 
+                                         BufferedInputReaderType *readerPtr,
+                                         char *capturedString )
+       {
+        // initialize variables
+        bool clearLeadingNonPrintable = true;
+        bool clearLeadingSpace = true;
+        bool stopAtNonPrintable = true;
+        char delimiter = NON_PRINTABLE;
+
+        // call utility function, return
+        return readStringConfiguredFromBufferedReader( readerPtr,
+                                               clearLeadingNonPrintable, 
+                                               clearLeadingSpace, 
+                                               stopAtNonPrintable, 
+                                               delimiter,
+                                               capturedString );
        }
 
    /*
@@ -670,9 +1849,30 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: string found if successful
     Device input/file: character(s) captured from file as needed
     Device output/monitor: none
-    Dependencies: readStringConfigured with appropriate parameters
+    Dependencies: accessDefaultInputReader, readStringToLineEndFromReader
     */
     bool readStringToLineEndFromFile( char *capturedString )
+       {
+        // call reader version with default reader, return
+           // function: accessDefaultInputReader, readStringToLineEndFromReader
+        return readStringToLineEndFromReader( accessDefaultInputReader(),
+                                              capturedString );
+       }
+
+   /*
+    Name: readStringToLineEndFromReader
+    process: ignores leading white space, including space character,
+             captures series of characters up to end of current line
+             or full string
+    Function input/parameters: reader (InputFileReaderType *)
+    Function output/parameters: captured string (char *), EMPTY_STRING otherwise
+    Function output/returned: string found if successful
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: readStringConfiguredFromReader with appropriate parameters
+    */
+    bool readStringToLineEndFromReader( InputFileReaderType *readerPtr,
+                                        char *capturedString )
        {
         // initialize variables
         bool clearLeadingNonPrintable = true;
@@ -681,11 +1881,45 @@ non-commercial use as long as the above copyright statement is included.
         char delimiter = NON_PRINTABLE;
 
         // call utility function, return
-        return readStringConfiguredFromFile( clearLeadingNonPrintable, 
-                                             clearLeadingSpace, 
-                                             stopAtNonPrintable, 
-                                             delimiter,
-                                             capturedString );
+        return readStringConfiguredFromReader( readerPtr,
+                                               clearLeadingNonPrintable, 
+                                               clearLeadingSpace, 
+                                               stopAtNonPrintable, 
+                                                 delimiter,
+                                               capturedString );
+       }
+
+   /*
+    Name: readStringToDelimiterFromBufferedReader
+    process: ignores leading white space, including space character,
+             captures series of characters up to specified character,
+             using block scan of buffer
+    Function input/parameters: buffered reader (BufferedInputReaderType *),
+                               delimiter (char)
+    Function output/parameters: captured string (char *), EMPTY_STRING otherwise
+    Function output/returned: string found if successful
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: readStringConfiguredFromBufferedReader 
+                  with appropriate parameters
+    */
+    bool readStringToDelimiterFromBufferedReader( 
+                                          BufferedInputReaderType *readerPtr,
+                                          char delimiter, 
+                                          char *capturedString )
+       {
+        // initialize variables
+        bool clearLeadingNonPrintable = true;
+        bool clearLeadingSpace = true;
+        bool stopAtNonPrintable = true;
+
+        // call utility function, return
+        return readStringConfiguredFromBufferedReader( readerPtr,
+                                               clearLeadingNonPrintable, 
+                                               clearLeadingSpace, 
+                                               stopAtNonPrintable, 
+                                               delimiter,
+                                               capturedString );
        }
 
    /*
@@ -697,9 +1931,31 @@ non-commercial use as long as the above copyright statement is included.
     Function output/returned: string found if successful
     Device input/file: character(s) captured from file as needed
     Device output/monitor: none
-    Dependencies: readStringConfigured with appropriate parameters
+    Dependencies: accessDefaultInputReader, readStringToDelimiterFromReader
     */
     bool readStringToDelimiterFromFile( char delimiter, char *capturedString )
+       {
+        // call reader version with default reader, return
+           // function: accessDefaultInputReader, 
+           //           readStringToDelimiterFromReader
+        return readStringToDelimiterFromReader( accessDefaultInputReader(),
+                                                delimiter, capturedString );
+       }
+
+   /*
+    Name: readStringToDelimiterFromReader
+    process: ignores leading white space, including space character,
+             captures series of characters up to specified character
+    Function input/parameters: reader (InputFileReaderType *)
+    Function output/parameters: captured string (char *), EMPTY_STRING otherwise
+    Function output/returned: string found if successful
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: readStringConfiguredFromReader with appropriate parameters
+    */
+    bool readStringToDelimiterFromReader( InputFileReaderType *readerPtr,
+                                          char delimiter, 
+                                          char *capturedString )
        {
         // initialize variables
         bool clearLeadingNonPrintable = true;
@@ -707,12 +1963,47 @@ non-commercial use as long as the above copyright statement is included.
         bool stopAtNonPrintable = true;
 
         // call utility function, return
-        return readStringConfiguredFromFile( clearLeadingNonPrintable, 
-                                             clearLeadingSpace, 
-                                             stopAtNonPrintable, 
-                                             delimiter,
-                                             capturedString );
+        return readStringConfiguredFromReader( readerPtr,
+                                               clearLeadingNonPrintable, 
+                                               clearLeadingSpace, 
+                                               stopAtNonPrintable, 
+                                                 delimiter,
+                                               capturedString );
        }
 
+   /*
+    Name: skipCsvRecordInMappedFile
+    process: skips remaining fields of current record in mapped file,
+             up to and including end of line
+    Function input/parameters: mapped file (MappedInputFileType *)
+    Function output/parameters: none
+    Function output/returned: success of operation, false if at end of file
+    Device input/file: none, file is already mapped
+    Device output/monitor: none
+    Dependencies: readCsvFieldFromMappedFile
+    */
+    bool skipCsvRecordInMappedFile( MappedInputFileType *mappedFile )
+       {
+        // initialize variables
+        char dummyStr[ MIN_STR_LEN ];
+        bool endOfRecord = false;
+        bool foundData = false;
+
+        // loop across fields to end of record
+        while( !endOfRecord )
+           {
+            // capture and discard field
+               // function: readCsvFieldFromMappedFile
+            if( !readCsvFieldFromMappedFile( mappedFile, dummyStr, 
+                                                   MIN_STR_LEN, &endOfRecord ) )
+               {
+                // return whether anything was skipped
+                return foundData;
+               }
 
+            foundData = true;
+           }
 
+        // return successful operation
+        return true;
+       }
@@ -34,6 +34,44 @@ UTILITY USAGE INSTRUCTIONS:
 #include <stdio.h>
 #include "StandardConstants.h"
 
+// data structures
+
+    // input file and end of file state for one reader
+    typedef struct InputFileReaderStruct
+       {
+        FILE *filePtr;
+
+        bool endOfFileFlag;
+       } InputFileReaderType;
+
+    // input file read in blocks, fields are scanned inside buffer
+    typedef struct BufferedInputReaderStruct
+       {
+        FILE *filePtr;
+
+        char *bufferPtr;
+
+        int bufferCount, bufferPosition;
+
+        bool endOfFileFlag;
+       } BufferedInputReaderType;
+
+    // whole file mapped into memory, read by position
+    typedef struct MappedInputFileStruct
+       {
+        const char *dataPtr;
+
+        long fileSize;
+
+        long position;
+
+#ifdef _WIN32
+        void *fileHandle, *mappingHandle;
+#else
+        int fileDescriptor;
+#endif
+       } MappedInputFileType;
+
 // constants shared with other files
 
     // non printable flag, used in getStringConfigured
@@ -45,25 +83,42 @@ UTILITY USAGE INSTRUCTIONS:
     // constant used for zero int/double value return
     static const char ZERO_VALUE = 0;
 
+    // size of block read by buffered reader
+    static const int INPUT_BUFFER_SIZE = 65536;
+
 // function prototypes
 
+    /*
+    Name: accessDefaultInputReader
+    process: provides reader used by functions without reader parameter;
+             note: reader is maintained (static) value initialized to
+             no file and end of file flag false
+    Function input/parameters: none
+    Function output/parameters: none
+    Function output/returned: pointer to default reader (InputFileReaderType *)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    InputFileReaderType *accessDefaultInputReader();
+
     /*
     Name: accessEndOfInputFileFlag
     process: allows accessing or modifying end of file flag state;
-             note: flag is maintained (static) value initialized to false
+             note: flag is maintained in default reader, initialized to false
     Function input/parameters: control code (int), flag state (bool)
     Function output/parameters: none
     Function output/returned: result of flag state (bool)
     Device input/file: none
     Device output/monitor: none
-    Dependencies: none
+    Dependencies: accessDefaultInputReader
     */
     bool accessEndOfInputFileFlag( int ctrlCode, bool setFlag );
 
     /*
     Name: accessInputFilePointer
     process: allows setting or accessing file pointer;
-             note: pointer is maintained (static) value initialized to NULL
+             note: pointer is maintained in default reader, initialized to NULL
     Function input/parameters: control code (int), file pointer (FILE *)
                                DUMMY_INPUT_FILE_PTR used 
                                if not setting file pointer
@@ -71,10 +126,36 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: file pointer (FILE *)
     Device input/file: none
     Device output/monitor: none
-    Dependencies: none
+    Dependencies: accessDefaultInputReader
     */
     FILE *accessInputFilePointer( int ctrlCode, const FILE *filePtr );
 
+    /*
+    Name: checkForBufferedReaderOpen
+    process: checks to see if file of buffered reader is currently open
+             returns true if file pointer not null, false otherwise
+    Function input/parameters: buffered reader (BufferedInputReaderType *)
+    Function output/parameters: none
+    Function output/returned: result of specified test (bool)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    bool checkForBufferedReaderOpen( BufferedInputReaderType *readerPtr );
+
+    /*
+    Name: checkForEndOfBufferedReader
+    process: checks to see if end of file flag has been encountered,
+             returns true if EOF has been encountered, false otherwise
+    Function input/parameters: buffered reader (BufferedInputReaderType *)
+    Function output/parameters: none
+    Function output/returned: result of specified test (bool)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    bool checkForEndOfBufferedReader( BufferedInputReaderType *readerPtr );
+
     /*
     Name: checkForEndOfInputFile
     process: checks to see if end of file flag has been encountered,
@@ -84,10 +165,36 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: result of specified test (bool)
     Device input/file: none
     Device output/monitor: none
-    Dependencies: accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, checkForEndOfInputReader
     */
     bool checkForEndOfInputFile();
 
+    /*
+    Name: checkForEndOfInputReader
+    process: checks to see if end of file flag has been encountered,
+             returns true if EOF has been encountered, false otherwise
+    Function input/parameters: reader (InputFileReaderType *)
+    Function output/parameters: none
+    Function output/returned: result of specified test (bool)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    bool checkForEndOfInputReader( InputFileReaderType *readerPtr );
+
+    /*
+    Name: checkForEndOfMappedFile
+    process: checks to see if all bytes of mapped file have been read,
+             returns true if at end of file, false otherwise
+    Function input/parameters: mapped file (const MappedInputFileType *)
+    Function output/parameters: none
+    Function output/returned: result of specified test (bool)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    bool checkForEndOfMappedFile( const MappedInputFileType *mappedFile );
+
     /*
     Name: checkForInputFileOpen
     process: checks to see if file is currently open
@@ -97,10 +204,23 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: result of specified test (bool)
     Device input/file: none
     Device output/monitor: none
-    Dependencies: accessInputFilePointer
+    Dependencies: accessDefaultInputReader, checkForInputReaderOpen
     */
     bool checkForInputFileOpen();
 
+    /*
+    Name: checkForInputReaderOpen
+    process: checks to see if file is currently open
+             returns true if file pointer not null, false otherwise
+    Function input/parameters: reader (InputFileReaderType *)
+    Function output/parameters: none
+    Function output/returned: result of specified test (bool)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    bool checkForInputReaderOpen( InputFileReaderType *readerPtr );
+
     /*
     Name: clearLeadingWhiteSpace
     process: captures non printable characters,
@@ -115,6 +235,19 @@ UTILITY USAGE INSTRUCTIONS:
     */
     int clearLeadingWhiteSpace( FILE *filePtr, bool clearSpace );
 
+    /*
+    Name: closeBufferedReader
+    process: closes file of buffered reader and releases its buffer,
+             returns true if successful, false otherwise
+    Function input/parameters: buffered reader (BufferedInputReaderType *)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: file closed
+    Device output/monitor: none
+    Dependencies: fclose, free
+    */
+    bool closeBufferedReader( BufferedInputReaderType *readerPtr );
+
     /*
     Name: closeInputFile
     process: closes input file, returns true if successful, false otherwise
@@ -123,10 +256,144 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: none
     Device input/file: file closed
     Device output/monitor: none
-    Dependencies: accessInputFilePointer, fclose, accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, closeInputReader
     */
     bool closeInputFile();
 
+    /*
+    Name: closeInputReader
+    process: closes input file, returns true if successful, false otherwise
+    Function input/parameters: reader (InputFileReaderType *)
+    Function output/parameters: none
+    Function output/returned: none
+    Device input/file: file closed
+    Device output/monitor: none
+    Dependencies: fclose
+    */
+    bool closeInputReader( InputFileReaderType *readerPtr );
+
+    /*
+    Name: closeMappedInputFile
+    process: unmaps and closes mapped input file, 
+             returns true if successful, false otherwise
+    Function input/parameters: mapped file (MappedInputFileType *)
+    Function output/parameters: mapped file cleared (MappedInputFileType *)
+    Function output/returned: success of operation (bool)
+    Device input/file: file closed
+    Device output/monitor: none
+    Dependencies: munmap, close (UnmapViewOfFile, CloseHandle on Windows)
+    */
+    bool closeMappedInputFile( MappedInputFileType *mappedFile );
+
+    /*
+    Name: copyBytesToString
+    process: appends given number of bytes to captured string,
+             bytes that do not fit capacity are dropped,
+             string is not terminated
+    Function input/parameters: source bytes (const char *), 
+                               number of bytes (long), 
+                               current string length (int),
+                               capacity of captured string (int)
+    Function output/parameters: captured string (char *)
+    Function output/returned: new string length (int)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    int copyBytesToString( const char *sourcePtr, long numBytes, 
+                           char *capturedString, int index, int capacity );
+
+    /*
+    Name: fillBufferedReader
+    process: replaces buffer contents with next block of file,
+             returns true if any data was read, false at end of file
+    Function input/parameters: buffered reader (BufferedInputReaderType *)
+    Function output/parameters: buffered reader with new data 
+                                (BufferedInputReaderType *)
+    Function output/returned: success of operation (bool)
+    Device input/file: block of data captured from file
+    Device output/monitor: none
+    Dependencies: fread
+    */
+    bool fillBufferedReader( BufferedInputReaderType *readerPtr );
+
+    /*
+    Name: findNextDelimiter
+    process: finds first byte that matches any of three delimiters,
+             or is a control character (below space) if flag set;
+             compares 32 bytes at a time with AVX2 or 16 with SSE2
+             when compiled for them, otherwise one at a time
+    Function input/parameters: bytes to scan (const char *), 
+                               number of bytes (long),
+                               three delimiters (char), repeat one
+                               delimiter if fewer are needed,
+                               stop at control character flag (bool)
+    Function output/parameters: none
+    Function output/returned: offset of first stop byte, 
+                              number of bytes if none found (long)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: SSE2/AVX2 intrinsics when available, __builtin_ctz
+    */
+    long findNextDelimiter( const char *dataPtr, long numBytes, 
+                            char delimOne, char delimTwo, char delimThree,
+                            bool stopAtNonPrintable );
+
+    /*
+    Name: getBufferedCharacter
+    process: takes next character from buffer, refilling as needed
+    Function input/parameters: buffered reader (BufferedInputReaderType *)
+    Function output/parameters: none
+    Function output/returned: character as unsigned value, EOF at end (int)
+    Device input/file: block of data captured from file as needed
+    Device output/monitor: none
+    Dependencies: fillBufferedReader
+    */
+    int getBufferedCharacter( BufferedInputReaderType *readerPtr );
+
+    /*
+    Name: initializeBufferedReader
+    process: sets buffered reader to no open file, no buffer,
+             and end of file flag false,
+             must be used before first open of a reader
+    Function input/parameters: none
+    Function output/parameters: initialized reader (BufferedInputReaderType *)
+    Function output/returned: none
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    void initializeBufferedReader( BufferedInputReaderType *readerPtr );
+
+    /*
+    Name: initializeInputReader
+    process: sets reader to no open file and end of file flag false,
+             must be used before first open of a reader
+    Function input/parameters: none
+    Function output/parameters: initialized reader (InputFileReaderType *)
+    Function output/returned: none
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    void initializeInputReader( InputFileReaderType *readerPtr );
+
+   /*
+    Name: openBufferedReader
+    process: opens input file for block reads and creates its buffer,
+             unsets end of file flag,
+             returns true if successful, false otherwise
+    Function input/parameters: buffered reader (BufferedInputReaderType *),
+                               file name (c-string)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: file opened
+    Device output/monitor: none
+    Dependencies: checkForBufferedReaderOpen, fopen, malloc
+    */
+    bool openBufferedReader( BufferedInputReaderType *readerPtr,
+                             const char *fileName );
+
    /*
     Name: openInputFile
     process: opens input file, sets file pointer and unsets end of file flag,
@@ -136,10 +403,42 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: success of operation (bool)
     Device input/file: file opened
     Device output/monitor: none
-    Dependencies: fopen, accessInputFilePointer, accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, openInputReader
     */
     bool openInputFile( const char *fileName );
-    
+
+   /*
+    Name: openInputReader
+    process: opens input file, sets file pointer and unsets end of file flag,
+             returns true if successful, false otherwise
+    Function input/parameters: reader (InputFileReaderType *),
+                               file name (c-string)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: file opened
+    Device output/monitor: none
+    Dependencies: fopen
+    */
+    bool openInputReader( InputFileReaderType *readerPtr,
+                          const char *fileName );
+
+   /*
+    Name: openMappedInputFile
+    process: opens input file and maps whole file into memory read only,
+             sets read position to start of file,
+             returns true if successful, false otherwise
+    Function input/parameters: file name (c-string)
+    Function output/parameters: mapped file (MappedInputFileType *)
+    Function output/returned: success of operation (bool)
+    Device input/file: file opened and mapped
+    Device output/monitor: none
+    Dependencies: open, fstat, mmap, close 
+                  (CreateFileA, GetFileSizeEx, CreateFileMappingA, 
+                   MapViewOfFile, CloseHandle on Windows)
+    */
+    bool openMappedInputFile( MappedInputFileType *mappedFile, 
+                                                         const char *fileName );
+
     /*
     Name: readCharacterFromFile
     process: ignores leading unprintable characters, including space,
@@ -149,10 +448,23 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: character found if successful, ZERO_CHAR otherwise
     Device input/file: character(s) captured from file as needed
     Device output/monitor: none
-    Dependencies: readCharacterFromFileConfigured
+    Dependencies: accessDefaultInputReader, readCharacterFromReader
     */
     char readCharacterFromFile();
 
+    /*
+    Name: readCharacterFromReader
+    process: ignores leading unprintable characters, including space,
+             captures first printable character
+    Function input/parameters: reader (InputFileReaderType *)
+    Function output/parameters: none
+    Function output/returned: character found if successful, ZERO_CHAR otherwise
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: readCharacterFromReaderConfigured
+    */
+    char readCharacterFromReader( InputFileReaderType *readerPtr );
+
     /*
     Name: readCharacterFromFileConfigured
     process: ignores leading unprintable characters,
@@ -163,12 +475,63 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: character found if successful, ZERO_CHAR otherwise
     Device input/file: character(s) captured from file as needed
     Device output/monitor: none
-    Dependencies: checkForInputFileOpen, checkForEndOfInputFile, 
-                  accessInputFilePointer, clearLeadingWhiteSpace, 
-                  accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, readCharacterFromReaderConfigured
     */
     char readCharacterFromFileConfigured( bool captureSpace );
 
+    /*
+    Name: readCharacterFromReaderConfigured
+    process: ignores leading unprintable characters,
+             captures first printable character,
+             including space if allowed
+    Function input/parameters: reader (InputFileReaderType *),
+                               allow space capture (bool)
+    Function output/parameters: none
+    Function output/returned: character found if successful, ZERO_CHAR otherwise
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: checkForInputReaderOpen, checkForEndOfInputReader,
+                  clearLeadingWhiteSpace
+    */
+    char readCharacterFromReaderConfigured( InputFileReaderType *readerPtr,
+                                            bool captureSpace );
+
+    /*
+    Name: readCsvFieldFromMappedFile
+    process: ignores leading spaces, captures one comma separated field
+             directly from mapped bytes, including quoted fields
+             with embedded commas and doubled quotes,
+             stops at comma, end of line (LF or CRLF), or end of file
+             and consumes it, field is truncated to fit capacity
+    Function input/parameters: mapped file (MappedInputFileType *),
+                               capacity of captured string (int)
+    Function output/parameters: captured string (char *), EMPTY_STRING 
+                                otherwise, end of record flag (bool *)
+    Function output/returned: success of operation, false if at end of file
+    Device input/file: none, file is already mapped
+    Device output/monitor: none
+    Dependencies: findNextDelimiter, copyBytesToString
+    */
+    bool readCsvFieldFromMappedFile( MappedInputFileType *mappedFile,
+                                     char *capturedString, int capacity, 
+                                     bool *endOfRecord );
+
+    /*
+    Name: readCsvIntegerFromMappedFile
+    process: captures one comma separated field as a signed integer
+             directly from mapped bytes, ignores surrounding spaces,
+             stops at comma, end of line, or end of file and consumes it;
+             value too large for int is clamped to INT_MAX
+    Function input/parameters: mapped file (MappedInputFileType *)
+    Function output/parameters: end of record flag (bool *)
+    Function output/returned: integer found if successful, ZERO_VALUE otherwise
+    Device input/file: none, file is already mapped
+    Device output/monitor: none
+    Dependencies: readCsvFieldFromMappedFile
+    */
+    int readCsvIntegerFromMappedFile( MappedInputFileType *mappedFile, 
+                                                            bool *endOfRecord );
+
     /*
     Name: readDoubleFromFile
     process: ignores leading unprintable characters,
@@ -178,11 +541,23 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: double value found if successful (double)
     Device input/file: double value captured from file
     Device output/monitor: none
-    Dependencies: checkForInputFileOpen, checkForEndOfInputFile, 
-                  accessInputFilePointer, fscanf, accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, readDoubleFromReader
     */
     double readDoubleFromFile();
-      
+
+    /*
+    Name: readDoubleFromReader
+    process: ignores leading unprintable characters,
+             captures first contiguous double value
+    Function input/parameters: reader (InputFileReaderType *)
+    Function output/parameters: none
+    Function output/returned: double value found if successful (double)
+    Device input/file: double value captured from file
+    Device output/monitor: none
+    Dependencies: checkForInputReaderOpen, checkForEndOfInputReader, fscanf
+    */
+    double readDoubleFromReader( InputFileReaderType *readerPtr );
+
     /*
     Name: readIntegerFromFile
     process: ignores leading unprintable characters,
@@ -192,11 +567,23 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: integer found if successful, ZERO_VALUE otherwise
     Device input/file: character(s) captured from file as needed
     Device output/monitor: none
-    Dependencies: checkForInputFileOpen, checkForEndOfInputFile, 
-                  accessInputFilePointer, fscanf, accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, readIntegerFromReader
     */
     int readIntegerFromFile();
-      
+
+    /*
+    Name: readIntegerFromReader
+    process: ignores leading unprintable characters,
+             captures first contiguous integer
+    Function input/parameters: reader (InputFileReaderType *)
+    Function output/parameters: none
+    Function output/returned: integer found if successful, ZERO_VALUE otherwise
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: checkForInputReaderOpen, checkForEndOfInputReader, fscanf
+    */
+    int readIntegerFromReader( InputFileReaderType *readerPtr );
+
     /*
     Name: readLongFromFile
     process: ignores leading unprintable characters,
@@ -207,11 +594,24 @@ UTILITY USAGE INSTRUCTIONS:
                               ZERO_VALUE otherwise
     Device input/file: long value captured from file
     Device output/monitor: none
-    Dependencies: checkForInputFileOpen, checkForEndOfInputFile, 
-                  accessInputFilePointer, fscanf, accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, readLongFromReader
     */
     long readLongFromFile();
-      
+
+    /*
+    Name: readLongFromReader
+    process: ignores leading unprintable characters,
+             captures first contiguous long int
+    Function input/parameters: reader (InputFileReaderType *)
+    Function output/parameters: none
+    Function output/returned: long integer found if successful, 
+                              ZERO_VALUE otherwise
+    Device input/file: long value captured from file
+    Device output/monitor: none
+    Dependencies: checkForInputReaderOpen, checkForEndOfInputReader, fscanf
+    */
+    long readLongFromReader( InputFileReaderType *readerPtr );
+
     /*
     Name: readRawCharFromFile
     process: captures first character in file stream including non-printable
@@ -220,11 +620,54 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: character found if successful, ZERO_CHAR otherwise
     Device input/file: character captured from file
     Device output/monitor: none
-    Dependencies: checkForInputFileOpen, checkForEndOfInputFile, 
-                  accessInputFilePointer, fgetc, accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, readRawCharFromReader
     */
     char readRawCharFromFile();
 
+    /*
+    Name: readRawCharFromReader
+    process: captures first character in file stream including non-printable
+    Function input/parameters: reader (InputFileReaderType *)
+    Function output/parameters: none
+    Function output/returned: character found if successful, ZERO_CHAR otherwise
+    Device input/file: character captured from file
+    Device output/monitor: none
+    Dependencies: checkForInputReaderOpen, checkForEndOfInputReader, fgetc
+    */
+    char readRawCharFromReader( InputFileReaderType *readerPtr );
+
+    /*
+    Name: readStringConfiguredFromBufferedReader
+    Process: captures string with same options and results 
+             as readStringConfiguredFromReader:
+             - clear leading non printable (bool)
+             - clear leading space character (bool)
+             - adquires characters up to any non-printable (bool)
+             - adquires characters up to any printable delimiter (char)
+               - use constant NON_PRINTABLE if no delimiter
+             - also stops capture when full (MAX_STR_LEN)
+             characters of field are found with block scan of buffer
+             rather than one at a time
+             Note: This function consumes the last character input,
+             including the space, delimiter, or non-printable character
+    Function input/parameters: buffered reader (BufferedInputReaderType *),
+                               see process above
+    Function output/parameters: captured string (char *), EMPTY_STRING otherwise
+    Function output/returned: success of operation (bool)
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: checkForBufferedReaderOpen, checkForEndOfBufferedReader,
+                  getBufferedCharacter, fillBufferedReader, 
+                  findNextDelimiter, copyBytesToString
+    */
+    bool readStringConfiguredFromBufferedReader( 
+                                      BufferedInputReaderType *readerPtr,
+                                      bool clearLeadingNonPrintable, 
+                                      bool clearLeadingSpace, 
+                                      bool stopAtNonPrintable, 
+                                      char delimiter,
+                                      char *capturedString );
+
     /*
     Name: readStringConfiguredFromFile
     Process: captures string with options:
@@ -241,8 +684,7 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: success of operation (bool)
     Device input/file: character(s) captured from file as needed
     Device output/monitor: none
-    Dependencies: checkForInputFileOpen, checkForEndOfInputFile, 
-                  clearLeadingWhiteSpace, fgetc, accessEndOfInputFileFlag
+    Dependencies: accessDefaultInputReader, readStringConfiguredFromReader
     */
    bool readStringConfiguredFromFile( bool clearLeadingNonPrintable, 
                                       bool clearLeadingSpace, 
@@ -250,6 +692,33 @@ UTILITY USAGE INSTRUCTIONS:
                                       char delimiter,
                                       char *capturedString );
 
+    /*
+    Name: readStringConfiguredFromReader
+    Process: captures string with options:
+             - clear leading non printable (bool)
+             - clear leading space character (bool)
+             - adquires characters up to any non-printable (bool)
+             - adquires characters up to any printable delimiter (char)
+               - use constant NON_PRINTABLE if no delimiter
+             - also stops capture when full (MAX_STR_LEN)
+             Note: This function consumes the last character input,
+             including the space, delimiter, or non-printable character
+    Function input/parameters: reader (InputFileReaderType *),
+                               see process above
+    Function output/parameters: captured string (char *), EMPTY_STRING otherwise
+    Function output/returned: success of operation (bool)
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: checkForInputReaderOpen, checkForEndOfInputReader,
+                  clearLeadingWhiteSpace, fgetc
+    */
+   bool readStringConfiguredFromReader( InputFileReaderType *readerPtr,
+                                      bool clearLeadingNonPrintable, 
+                                      bool clearLeadingSpace, 
+                                      bool stopAtNonPrintable, 
+                                      char delimiter,
+                                      char *capturedString );
+
    /*
     Name: readStringSegmentFromFile
     process: ignores leading white space, including space character,
@@ -260,10 +729,42 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: success of operation (bool)
     Device input/file: character(s) captured from file as needed
     Device output/monitor: none
-    Dependencies: readStringConfigured with appropriate parameters
+    Dependencies: accessDefaultInputReader, readStringSegmentFromReader
     */
     bool readStringSegmentFromFile( char *capturedString );
 
+   /*
+    Name: readStringSegmentFromReader
+    process: ignores leading white space, including space character,
+             captures series of characters up to first space,
+             or end of line, or full string
+    Function input/parameters: reader (InputFileReaderType *)
+    Function output/parameters: captured string (char *), EMPTY_STRING otherwise
+    Function output/returned: success of operation (bool)
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: readStringConfiguredFromReader with appropriate parameters
+    */
+    bool readStringSegmentFromReader( InputFileReaderType *readerPtr,
+                                      char *capturedString );
+
+   /*
+    Name: readStringToLineEndFromBufferedReader
+    process: ignores leading white space, including space character,
+             captures series of characters up to end of current line
+             or full string, using block scan of buffer
+    Function input/parameters: buffered reader (BufferedInputReaderType *)
+    Function output/parameters: captured string (char *), EMPTY_STRING otherwise
+    Function output/returned: string found if successful
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: readStringConfiguredFromBufferedReader 
+                  with appropriate parameters
+    */
+    bool readStringToLineEndFromBufferedReader( 
+                                         BufferedInputReaderType *readerPtr,
+                                         char *capturedString );
+
    /*
     Name: readStringToLineEndFromFile
     process: ignores leading white space, including space character,
@@ -274,10 +775,44 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: string found if successful
     Device input/file: character(s) captured from file as needed
     Device output/monitor: none
-    Dependencies: readStringConfigured with appropriate parameters
+    Dependencies: accessDefaultInputReader, readStringToLineEndFromReader
     */
     bool readStringToLineEndFromFile( char *capturedString );
 
+   /*
+    Name: readStringToLineEndFromReader
+    process: ignores leading white space, including space character,
+             captures series of characters up to end of current line
+             or full string
+    Function input/parameters: reader (InputFileReaderType *)
+    Function output/parameters: captured string (char *), EMPTY_STRING otherwise
+    Function output/returned: string found if successful
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: readStringConfiguredFromReader with appropriate parameters
+    */
+    bool readStringToLineEndFromReader( InputFileReaderType *readerPtr,
+                                        char *capturedString );
+
+   /*
+    Name: readStringToDelimiterFromBufferedReader
+    process: ignores leading white space, including space character,
+             captures series of characters up to specified character,
+             using block scan of buffer
+    Function input/parameters: buffered reader (BufferedInputReaderType *),
+                               delimiter (char)
+    Function output/parameters: captured string (char *), EMPTY_STRING otherwise
+    Function output/returned: string found if successful
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: readStringConfiguredFromBufferedReader 
+                  with appropriate parameters
+    */
+    bool readStringToDelimiterFromBufferedReader( 
+                                          BufferedInputReaderType *readerPtr,
+                                          char delimiter, 
+                                          char *capturedString );
+
    /*
     Name: readStringToDelimiterFromFile
     process: ignores leading white space, including space character,
@@ -287,9 +822,37 @@ UTILITY USAGE INSTRUCTIONS:
     Function output/returned: string found if successful
     Device input/file: character(s) captured from file as needed
     Device output/monitor: none
-    Dependencies: readStringConfigured with appropriate parameters
+    Dependencies: accessDefaultInputReader, readStringToDelimiterFromReader
     */
     bool readStringToDelimiterFromFile( char delimiter, char *capturedString );
 
+   /*
+    Name: readStringToDelimiterFromReader
+    process: ignores leading white space, including space character,
+             captures series of characters up to specified character
+    Function input/parameters: reader (InputFileReaderType *)
+    Function output/parameters: captured string (char *), EMPTY_STRING otherwise
+    Function output/returned: string found if successful
+    Device input/file: character(s) captured from file as needed
+    Device output/monitor: none
+    Dependencies: readStringConfiguredFromReader with appropriate parameters
+    */
+    bool readStringToDelimiterFromReader( InputFileReaderType *readerPtr,
+                                          char delimiter, 
+                                          char *capturedString );
+
+   /*
+    Name: skipCsvRecordInMappedFile
+    process: skips remaining fields of current record in mapped file,
+             up to and including end of line
+    Function input/parameters: mapped file (MappedInputFileType *)
+    Function output/parameters: none
+    Function output/returned: success of operation, false if at end of file
+    Device input/file: none, file is already mapped
+    Device output/monitor: none
+    Dependencies: readCsvFieldFromMappedFile
+    */
+    bool skipCsvRecordInMappedFile( MappedInputFileType *mappedFile );
+
 #endif  // FILE_INPUT_UTILITY_H
 
@@ -0,0 +1,607 @@
+/*
+Buffered file output utility, function implementations
+*/
+
+// header files
+#include "File_Output_Utility.h"
+#include <stdlib.h>
+
+// local global constants, used only in this file
+
+    // first decimal digit character, used by writeIntegerToBufferedWriter
+    static const char ZERO_DIGIT = '0';
+
+    // two digit text of 0 through 99, used by writeIntegerToBufferedWriter
+    static const char DIGIT_PAIRS[] =
+                         "00010203040506070809101112131415161718192021222324"
+                         "25262728293031323334353637383940414243444546474849"
+                         "50515253545556575859606162636465666768697071727374"
+                         "75767778798081828384858687888990919293949596979899";
+
+    /*
+    Name: accessDefaultOutputWriter
+    process: provides writer on standard output used by display functions;
+             note: writer is maintained (static) value, its buffer is
+             created on first access and flushed at program exit
+    Function input/parameters: none
+    Function output/parameters: none
+    Function output/returned: pointer to default writer
+                              (BufferedOutputWriterType *)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: openBufferedWriterToStream, atexit
+    */
+    BufferedOutputWriterType *accessDefaultOutputWriter()
+       {
+        // initialize default writer to no output
+        static BufferedOutputWriterType defaultWriter 
+                                                 = { NULL, NULL, 0, false };
+
+        // check for first access
+           // function: openBufferedWriterToStream, atexit
+        if( defaultWriter.filePtr == NULL
+                       && openBufferedWriterToStream( &defaultWriter, stdout ) )
+           {
+            // make sure buffered output is not lost at exit
+            atexit( flushDefaultOutputWriter );
+           }
+
+        // return default writer
+        return &defaultWriter;
+       }
+
+    /*
+    Name: checkForBufferedWriterOpen
+    process: checks to see if buffered writer currently has an output,
+             returns true if file pointer not null, false otherwise
+    Function input/parameters: buffered writer (BufferedOutputWriterType *)
+    Function output/parameters: none
+    Function output/returned: result of specified test (bool)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    bool checkForBufferedWriterOpen( BufferedOutputWriterType *writerPtr )
+       {
+        // return test of file pointer
+        return writerPtr->filePtr != NULL;
+       }
+
+    /*
+    Name: closeBufferedWriter
+    process: writes remaining buffer contents, closes file if writer
+             opened it, and releases buffer,
+             returns true if successful, false otherwise
+    Function input/parameters: buffered writer (BufferedOutputWriterType *)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/file: remaining data written, file closed
+    Dependencies: flushBufferedWriter, fclose, free, initializeBufferedWriter
+    */
+    bool closeBufferedWriter( BufferedOutputWriterType *writerPtr )
+       {
+        // initialize variables
+        bool success;
+
+        // check for valid file pointer
+        if( checkForBufferedWriterOpen( writerPtr ) )
+           {
+            // write what is left
+               // function: flushBufferedWriter
+            success = flushBufferedWriter( writerPtr );
+
+            // close file only if this writer opened it
+               // function: fclose
+            if( writerPtr->ownsFileFlag && fclose( writerPtr->filePtr ) != 0 )
+               {
+                success = false;
+               }
+
+            // release buffer and reset writer
+               // function: free, initializeBufferedWriter
+            free( writerPtr->bufferPtr );
+            initializeBufferedWriter( writerPtr );
+
+            // return result of operation
+            return success;
+           }
+
+        // return failed operation
+        return false;
+       }
+
+    /*
+    Name: flushBufferedWriter
+    process: writes buffer contents to file and empties buffer,
+             returns true if all data was written, false otherwise
+    Function input/parameters: buffered writer (BufferedOutputWriterType *)
+    Function output/parameters: emptied writer (BufferedOutputWriterType *)
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/file: block of data written
+    Dependencies: fwrite
+    */
+    bool flushBufferedWriter( BufferedOutputWriterType *writerPtr )
+       {
+        // initialize variables
+        int numWritten;
+
+        // check for no output
+        if( !checkForBufferedWriterOpen( writerPtr ) )
+           {
+            // return failed operation
+            return false;
+           }
+
+        // write block, empty buffer
+           // function: fwrite
+        numWritten = (int)fwrite( writerPtr->bufferPtr, 1,
+                                writerPtr->bufferCount, writerPtr->filePtr );
+
+        if( numWritten != writerPtr->bufferCount )
+           {
+            writerPtr->bufferCount = 0;
+
+            // return failed operation
+            return false;
+           }
+
+        writerPtr->bufferCount = 0;
+
+        // return successful operation
+        return true;
+       }
+
+    /*
+    Name: flushDefaultOutputWriter
+    process: writes buffer contents of default writer,
+             registered to run at program exit
+    Function input/parameters: none
+    Function output/parameters: none
+    Function output/returned: none
+    Device input/file: none
+    Device output/monitor: buffered data displayed
+    Dependencies: accessDefaultOutputWriter, flushBufferedWriter
+    */
+    void flushDefaultOutputWriter()
+       {
+        // write what is left of default writer
+           // function: accessDefaultOutputWriter, flushBufferedWriter
+        flushBufferedWriter( accessDefaultOutputWriter() );
+       }
+
+    /*
+    Name: initializeBufferedWriter
+    process: sets buffered writer to no file and no buffer,
+             must be used before first open of a writer
+    Function input/parameters: none
+    Function output/parameters: initialized writer
+                                (BufferedOutputWriterType *)
+    Function output/returned: none
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    void initializeBufferedWriter( BufferedOutputWriterType *writerPtr )
+       {
+        // set writer to no file, empty buffer
+        writerPtr->filePtr = NULL;
+        writerPtr->bufferPtr = NULL;
+        writerPtr->bufferCount = 0;
+        writerPtr->ownsFileFlag = false;
+       }
+
+    /*
+    Name: openBinaryBufferedWriter
+    process: creates or replaces output file in binary mode, so bytes
+             are written as given with no line ending translation,
+             and creates buffer, returns true if successful,
+             false otherwise
+    Function input/parameters: buffered writer (BufferedOutputWriterType *),
+                               file name (c-string)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/file: file opened
+    Dependencies: openBufferedWriterInMode
+    */
+    bool openBinaryBufferedWriter( BufferedOutputWriterType *writerPtr,
+                                   const char *fileName )
+       {
+        // initialize variables
+        char writeBinaryCharacters[] = "wb";
+
+        // open file in binary mode, return result
+           // function: openBufferedWriterInMode
+        return openBufferedWriterInMode( writerPtr, fileName,
+                                                      writeBinaryCharacters );
+       }
+
+    /*
+    Name: openBufferedWriter
+    process: creates or replaces output file in text mode and creates
+             buffer, returns true if successful, false otherwise
+    Function input/parameters: buffered writer (BufferedOutputWriterType *),
+                               file name (c-string)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/file: file opened
+    Dependencies: openBufferedWriterInMode
+    */
+    bool openBufferedWriter( BufferedOutputWriterType *writerPtr,
+                             const char *fileName )
+       {
+        // initialize variables
+        char writeOnlyCharacter[] = "w";
+
+        // open file in text mode, return result
+           // function: openBufferedWriterInMode
+        return openBufferedWriterInMode( writerPtr, fileName,
+                                                         writeOnlyCharacter );
+       }
+
+    /*
+    Name: openBufferedWriterInMode
+    process: creates or replaces output file, opened with given fopen
+             mode, and creates buffer, returns true if successful,
+             false otherwise
+    Function input/parameters: buffered writer (BufferedOutputWriterType *),
+                               file name, fopen mode (c-string)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/file: file opened
+    Dependencies: checkForBufferedWriterOpen, fopen, malloc
+    */
+    bool openBufferedWriterInMode( BufferedOutputWriterType *writerPtr,
+                                   const char *fileName, const char *mode )
+       {
+        // initialize variables
+        FILE *filePtr = NULL;
+
+        // check for file not open
+           // function: checkForBufferedWriterOpen
+        if( !checkForBufferedWriterOpen( writerPtr ) )
+           {
+            // open file
+               // function: fopen
+            filePtr = fopen( fileName, mode );
+
+            // check for success of file open
+            if( filePtr != NULL )
+               {
+                // set pointer and empty buffer in writer
+                   // function: malloc
+                writerPtr->filePtr = filePtr;
+                writerPtr->bufferPtr = (char *)malloc( OUTPUT_BUFFER_SIZE );
+                writerPtr->bufferCount = 0;
+                writerPtr->ownsFileFlag = true;
+
+                // return operation success
+                return true;
+               }
+           }
+
+        // return operation failure
+        return false;
+       }
+
+    /*
+    Name: openBufferedWriterToStream
+    process: creates buffer for already open stream such as stdout,
+             stream is not closed when writer is closed,
+             returns true if successful, false otherwise
+    Function input/parameters: buffered writer (BufferedOutputWriterType *),
+                               open stream (FILE *)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: checkForBufferedWriterOpen, malloc
+    */
+    bool openBufferedWriterToStream( BufferedOutputWriterType *writerPtr,
+                                     FILE *streamPtr )
+       {
+        // check for writer not open and stream given
+           // function: checkForBufferedWriterOpen
+        if( !checkForBufferedWriterOpen( writerPtr ) && streamPtr != NULL )
+           {
+            // set stream and empty buffer in writer
+               // function: malloc
+            writerPtr->filePtr = streamPtr;
+            writerPtr->bufferPtr = (char *)malloc( OUTPUT_BUFFER_SIZE );
+            writerPtr->bufferCount = 0;
+            writerPtr->ownsFileFlag = false;
+
+            // return operation success
+            return true;
+           }
+
+        // return operation failure
+        return false;
+       }
+
+    /*
+    Name: writeBytesToBufferedWriter
+    process: adds given bytes to buffer, writing buffer out when full,
+             block larger than buffer is written directly
+    Function input/parameters: buffered writer (BufferedOutputWriterType *),
+                               bytes (const char *), number of bytes (int)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/file: data written when buffer fills
+    Dependencies: checkForBufferedWriterOpen, flushBufferedWriter, fwrite
+    */
+    bool writeBytesToBufferedWriter( BufferedOutputWriterType *writerPtr,
+                                     const char *dataPtr, int numBytes )
+       {
+        // initialize variables
+        char *destPtr;
+        int index;
+
+        // check for no output
+           // function: checkForBufferedWriterOpen
+        if( !checkForBufferedWriterOpen( writerPtr ) )
+           {
+            // return failed operation
+            return false;
+           }
+
+        // check for not enough room left in buffer
+        if( writerPtr->bufferCount + numBytes > OUTPUT_BUFFER_SIZE )
+           {
+            // empty buffer
+               // function: flushBufferedWriter
+            if( !flushBufferedWriter( writerPtr ) )
+               {
+                // return failed operation
+                return false;
+               }
+
+            // check for block that can never fit
+            if( numBytes > OUTPUT_BUFFER_SIZE )
+               {
+                // write it directly, return result
+                   // function: fwrite
+                return (int)fwrite( dataPtr, 1, numBytes, writerPtr->filePtr )
+                                                                  == numBytes;
+               }
+           }
+
+        // copy bytes into buffer
+        destPtr = writerPtr->bufferPtr + writerPtr->bufferCount;
+
+        for( index = 0; index < numBytes; index++ )
+           {
+            destPtr[ index ] = dataPtr[ index ];
+           }
+
+        writerPtr->bufferCount += numBytes;
+
+        // return successful operation
+        return true;
+       }
+
+    /*
+    Name: writeCharacterToBufferedWriter
+    process: adds one character to buffer, writing buffer out when full
+    Function input/parameters: buffered writer (BufferedOutputWriterType *),
+                               output character (char)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/file: data written when buffer fills
+    Dependencies: checkForBufferedWriterOpen, flushBufferedWriter
+    */
+    bool writeCharacterToBufferedWriter( BufferedOutputWriterType *writerPtr,
+                                         char outChar )
+       {
+        // check for no output, or full buffer that cannot be emptied
+           // function: checkForBufferedWriterOpen, flushBufferedWriter
+        if( !checkForBufferedWriterOpen( writerPtr )
+                || ( writerPtr->bufferCount == OUTPUT_BUFFER_SIZE
+                                    && !flushBufferedWriter( writerPtr ) ) )
+           {
+            // return failed operation
+            return false;
+           }
+
+        // add character
+        writerPtr->bufferPtr[ writerPtr->bufferCount ] = outChar;
+        writerPtr->bufferCount++;
+
+        // return successful operation
+        return true;
+       }
+
+    /*
+    Name: writeDelimitedFieldToBufferedWriter
+    process: adds text as one field of delimited record, text holding
+             delimiter, quote or line end is quoted with quotes doubled,
+             as read back by readCsvFieldFromMappedFile
+    Function input/parameters: buffered writer (BufferedOutputWriterType *),
+                               field text (const char *),
+                               field delimiter (char)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/file: data written when buffer fills
+    Dependencies: writeBytesToBufferedWriter, writeCharacterToBufferedWriter
+    */
+    bool writeDelimitedFieldToBufferedWriter(
+                              BufferedOutputWriterType *writerPtr,
+                                         const char *text, char delimiter )
+       {
+        // initialize variables
+        int index = 0;
+        bool success;
+
+        // look for character that needs quoting
+        while( text[ index ] != NULL_CHAR && text[ index ] != delimiter
+                  && text[ index ] != QUOTE && text[ index ] != NEWLINE_CHAR
+                                   && text[ index ] != CARRIAGE_RETURN_CHAR )
+           {
+            index++;
+           }
+
+        // check for plain field
+        if( text[ index ] == NULL_CHAR )
+           {
+            // write scanned text as one block, return result
+               // function: writeBytesToBufferedWriter
+            return writeBytesToBufferedWriter( writerPtr, text, index );
+           }
+
+        // write quoted field, doubling quotes
+           // function: writeCharacterToBufferedWriter
+        success = writeCharacterToBufferedWriter( writerPtr, QUOTE );
+
+        // loop across runs of text ending at quote or end of text
+        while( *text != NULL_CHAR )
+           {
+            for( index = 0; text[ index ] != NULL_CHAR
+                                        && text[ index ] != QUOTE; index++ );
+
+            // write run, then doubled quote if run ended at one
+               // function: writeBytesToBufferedWriter
+            success = writeBytesToBufferedWriter( writerPtr, text, index )
+                                                                   && success;
+
+            if( text[ index ] == QUOTE )
+               {
+                success = writeBytesToBufferedWriter( writerPtr, "\"\"", 2 )
+                                                                   && success;
+                index++;
+               }
+
+            text += index;
+           }
+
+        // return result of operation
+        return writeCharacterToBufferedWriter( writerPtr, QUOTE ) && success;
+       }
+
+    /*
+    Name: writeIntegerToBufferedWriter
+    process: adds decimal text of integer to buffer,
+             digits are formed two at a time from table, no printf
+    Function input/parameters: buffered writer (BufferedOutputWriterType *),
+                               value (long)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/file: data written when buffer fills
+    Dependencies: writeBytesToBufferedWriter
+    */
+    bool writeIntegerToBufferedWriter( BufferedOutputWriterType *writerPtr,
+                                       long value )
+       {
+        // initialize variables
+        char digitStr[ MIN_STR_LEN ];
+        int index = MIN_STR_LEN, pairIndex;
+        unsigned long magnitude = value < 0 ? 0UL - (unsigned long)value
+                                            : (unsigned long)value;
+
+        // form digits from right, two at a time
+        while( magnitude >= 100 )
+           {
+            pairIndex = (int)( magnitude % 100 ) * 2;
+            magnitude /= 100;
+
+            index -= 2;
+            digitStr[ index ] = DIGIT_PAIRS[ pairIndex ];
+            digitStr[ index + 1 ] = DIGIT_PAIRS[ pairIndex + 1 ];
+           }
+
+        // form last one or two digits
+        if( magnitude >= 10 )
+           {
+            pairIndex = (int)magnitude * 2;
+
+            index -= 2;
+            digitStr[ index ] = DIGIT_PAIRS[ pairIndex ];
+            digitStr[ index + 1 ] = DIGIT_PAIRS[ pairIndex + 1 ];
+           }
+
+        else
+           {
+            index--;
+            digitStr[ index ] = (char)( ZERO_DIGIT + magnitude );
+           }
+
+        // add sign
+        if( value < 0 )
+           {
+            index--;
+            digitStr[ index ] = DASH;
+           }
+
+        // write digits, return result
+           // function: writeBytesToBufferedWriter
+        return writeBytesToBufferedWriter( writerPtr, digitStr + index,
+                                                          MIN_STR_LEN - index );
+       }
+
+    /*
+    Name: writeRepeatedCharacterToBufferedWriter
+    process: adds character given number of times to buffer
+    Function input/parameters: buffered writer (BufferedOutputWriterType *),
+                               output character (char),
+                               number of characters (int)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/file: data written when buffer fills
+    Dependencies: writeCharacterToBufferedWriter
+    */
+    bool writeRepeatedCharacterToBufferedWriter(
+                              BufferedOutputWriterType *writerPtr,
+                                                 char outChar, int numChars )
+       {
+        // initialize variables
+        bool success = true;
+
+        // loop across characters
+           // function: writeCharacterToBufferedWriter
+        while( numChars > 0 )
+           {
+            success = writeCharacterToBufferedWriter( writerPtr, outChar )
+                                                                   && success;
+            numChars--;
+           }
+
+        // return result of operation
+        return success;
+       }
+
+    /*
+    Name: writeStringToBufferedWriter
+    process: adds c-string, without its null character, to buffer
+    Function input/parameters: buffered writer (BufferedOutputWriterType *),
+                               output string (const char *)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/file: data written when buffer fills
+    Dependencies: writeBytesToBufferedWriter
+    */
+    bool writeStringToBufferedWriter( BufferedOutputWriterType *writerPtr,
+                                      const char *outString )
+       {
+        // initialize variables
+        int index = 0;
+
+        // find length of string
+        while( outString[ index ] != NULL_CHAR )
+           {
+            index++;
+           }
+
+        // write string as one block, return result
+           // function: writeBytesToBufferedWriter
+        return writeBytesToBufferedWriter( writerPtr, outString, index );
+       }
+
@@ -0,0 +1,294 @@
+/*
+Buffered file output utility, function prototypes
+*/
+/*
+Rev 0.0: Initial creation of file
+
+UTILITY USAGE INSTRUCTIONS:
+
+1) This utility contains functions that may be used for bulk text output
+   to files or standard output using the C programming language.
+   Output is collected in a large buffer and written in blocks,
+   so writers must be flushed or closed before the data is needed.
+   The utility must be linked with the program code with which
+   it will be used.
+
+2) Specifications for all the functions
+    are provided in a standardized format below.
+
+3) Use this code at your own risk. There is no guarantee of any performance,
+   implied or otherwise, for any part of this code
+
+   END OF INSTRUCTIONS
+*/
+
+// PreProcessor test
+#ifndef FILE_OUTPUT_UTILITY_H
+#define FILE_OUTPUT_UTILITY_H
+
+// header files
+#include <stdbool.h>
+#include <stdio.h>
+#include "StandardConstants.h"
+
+// data structures
+
+    // output file and block buffer for one writer
+    typedef struct BufferedOutputWriterStruct
+       {
+        FILE *filePtr;
+
+        char *bufferPtr;
+
+        int bufferCount;
+
+        bool ownsFileFlag;
+       } BufferedOutputWriterType;
+
+// constants shared with other files
+
+    // size of block written by buffered writer
+    static const int OUTPUT_BUFFER_SIZE = 262144;
+
+// function prototypes
+
+    /*
+    Name: accessDefaultOutputWriter
+    process: provides writer on standard output used by display functions;
+             note: writer is maintained (static) value, its buffer is
+             created on first access and flushed at program exit
+    Function input/parameters: none
+    Function output/parameters: none
+    Function output/returned: pointer to default writer
+                              (BufferedOutputWriterType *)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: openBufferedWriterToStream, atexit
+    */
+    BufferedOutputWriterType *accessDefaultOutputWriter();
+
+    /*
+    Name: checkForBufferedWriterOpen
+    process: checks to see if buffered writer currently has an output,
+             returns true if file pointer not null, false otherwise
+    Function input/parameters: buffered writer (BufferedOutputWriterType *)
+    Function output/parameters: none
+    Function output/returned: result of specified test (bool)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    bool checkForBufferedWriterOpen( BufferedOutputWriterType *writerPtr );
+
+    /*
+    Name: closeBufferedWriter
+    process: writes remaining buffer contents, closes file if writer
+             opened it, and releases buffer,
+             returns true if successful, false otherwise
+    Function input/parameters: buffered writer (BufferedOutputWriterType *)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/file: remaining data written, file closed
+    Dependencies: flushBufferedWriter, fclose, free, initializeBufferedWriter
+    */
+    bool closeBufferedWriter( BufferedOutputWriterType *writerPtr );
+
+    /*
+    Name: flushBufferedWriter
+    process: writes buffer contents to file and empties buffer,
+             returns true if all data was written, false otherwise
+    Function input/parameters: buffered writer (BufferedOutputWriterType *)
+    Function output/parameters: emptied writer (BufferedOutputWriterType *)
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/file: block of data written
+    Dependencies: fwrite
+    */
+    bool flushBufferedWriter( BufferedOutputWriterType *writerPtr );
+
+    /*
+    Name: flushDefaultOutputWriter
+    process: writes buffer contents of default writer,
+             registered to run at program exit
+    Function input/parameters: none
+    Function output/parameters: none
+    Function output/returned: none
+    Device input/file: none
+    Device output/monitor: buffered data displayed
+    Dependencies: accessDefaultOutputWriter, flushBufferedWriter
+    */
+    void flushDefaultOutputWriter();
+
+    /*
+    Name: initializeBufferedWriter
+    process: sets buffered writer to no file and no buffer,
+             must be used before first open of a writer
+    Function input/parameters: none
+    Function output/parameters: initialized writer
+                                (BufferedOutputWriterType *)
+    Function output/returned: none
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    void initializeBufferedWriter( BufferedOutputWriterType *writerPtr );
+
+    /*
+    Name: openBinaryBufferedWriter
+    process: creates or replaces output file in binary mode, so bytes
+             are written as given with no line ending translation,
+             and creates buffer, returns true if successful,
+             false otherwise
+    Function input/parameters: buffered writer (BufferedOutputWriterType *),
+                               file name (c-string)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/file: file opened
+    Dependencies: openBufferedWriterInMode
+    */
+    bool openBinaryBufferedWriter( BufferedOutputWriterType *writerPtr,
+                                   const char *fileName );
+
+    /*
+    Name: openBufferedWriter
+    process: creates or replaces output file in text mode and creates
+             buffer, returns true if successful, false otherwise
+    Function input/parameters: buffered writer (BufferedOutputWriterType *),
+                               file name (c-string)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/file: file opened
+    Dependencies: openBufferedWriterInMode
+    */
+    bool openBufferedWriter( BufferedOutputWriterType *writerPtr,
+                             const char *fileName );
+
+    /*
+    Name: openBufferedWriterInMode
+    process: creates or replaces output file, opened with given fopen
+             mode, and creates buffer, returns true if successful,
+             false otherwise
+    Function input/parameters: buffered writer (BufferedOutputWriterType *),
+                               file name, fopen mode (c-string)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/file: file opened
+    Dependencies: checkForBufferedWriterOpen, fopen, malloc
+    */
+    bool openBufferedWriterInMode( BufferedOutputWriterType *writerPtr,
+                                   const char *fileName, const char *mode );
+
+    /*
+    Name: openBufferedWriterToStream
+    process: creates buffer for already open stream such as stdout,
+             stream is not closed when writer is closed,
+             returns true if successful, false otherwise
+    Function input/parameters: buffered writer (BufferedOutputWriterType *),
+                               open stream (FILE *)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: checkForBufferedWriterOpen, malloc
+    */
+    bool openBufferedWriterToStream( BufferedOutputWriterType *writerPtr,
+                                     FILE *streamPtr );
+
+    /*
+    Name: writeBytesToBufferedWriter
+    process: adds given bytes to buffer, writing buffer out when full,
+             block larger than buffer is written directly
+    Function input/parameters: buffered writer (BufferedOutputWriterType *),
+                               bytes (const char *), number of bytes (int)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/file: data written when buffer fills
+    Dependencies: checkForBufferedWriterOpen, flushBufferedWriter, fwrite
+    */
+    bool writeBytesToBufferedWriter( BufferedOutputWriterType *writerPtr,
+                                     const char *dataPtr, int numBytes );
+
+    /*
+    Name: writeCharacterToBufferedWriter
+    process: adds one character to buffer, writing buffer out when full
+    Function input/parameters: buffered writer (BufferedOutputWriterType *),
+                               output character (char)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/file: data written when buffer fills
+    Dependencies: checkForBufferedWriterOpen, flushBufferedWriter
+    */
+    bool writeCharacterToBufferedWriter( BufferedOutputWriterType *writerPtr,
+                                         char outChar );
+
+    /*
+    Name: writeDelimitedFieldToBufferedWriter
+    process: adds text as one field of delimited record, text holding
+             delimiter, quote or line end is quoted with quotes doubled,
+             as read back by readCsvFieldFromMappedFile
+    Function input/parameters: buffered writer (BufferedOutputWriterType *),
+                               field text (const char *),
+                               field delimiter (char)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/file: data written when buffer fills
+    Dependencies: writeBytesToBufferedWriter, writeCharacterToBufferedWriter
+    */
+    bool writeDelimitedFieldToBufferedWriter(
+                              BufferedOutputWriterType *writerPtr,
+                                         const char *text, char delimiter );
+
+    /*
+    Name: writeIntegerToBufferedWriter
+    process: adds decimal text of integer to buffer,
+             digits are formed two at a time from table, no printf
+    Function input/parameters: buffered writer (BufferedOutputWriterType *),
+                               value (long)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/file: data written when buffer fills
+    Dependencies: writeBytesToBufferedWriter
+    */
+    bool writeIntegerToBufferedWriter( BufferedOutputWriterType *writerPtr,
+                                       long value );
+
+    /*
+    Name: writeRepeatedCharacterToBufferedWriter
+    process: adds character given number of times to buffer
+    Function input/parameters: buffered writer (BufferedOutputWriterType *),
+                               output character (char),
+                               number of characters (int)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/file: data written when buffer fills
+    Dependencies: writeCharacterToBufferedWriter
+    */
+    bool writeRepeatedCharacterToBufferedWriter(
+                              BufferedOutputWriterType *writerPtr,
+                                                 char outChar, int numChars );
+
+    /*
+    Name: writeStringToBufferedWriter
+    process: adds c-string, without its null character, to buffer
+    Function input/parameters: buffered writer (BufferedOutputWriterType *),
+                               output string (const char *)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/file: data written when buffer fills
+    Dependencies: writeBytesToBufferedWriter
+    */
+    bool writeStringToBufferedWriter( BufferedOutputWriterType *writerPtr,
+                                      const char *outString );
+
+#endif  // FILE_OUTPUT_UTILITY_H
+
@@ -0,0 +1,199 @@
+// header files
+#include "Frozen_Tree_Utility.h"
+
+FrozenTreeType* clearFrozenTree(FrozenTreeType* frozenPtr)
+{
+    // release arrays, nodes belong to tree
+    free( frozenPtr->keyBlockPtr );
+    free( frozenPtr->payloadIndices );
+    free( frozenPtr->nodePtrs );
+
+    // release snapshot
+    free( frozenPtr );
+
+    // return cleared snapshot ptr
+    return NULL;
+}
+
+void fillFrozenSlots(FrozenTreeType* frozenPtr, int slotIndex,
+                          int* inOrderIndexPtr, unsigned long long* lastKeyPtr)
+{
+    // initialize variables
+    AvlTreeNodeType *nodePtr;
+
+    // check for slot past end
+    if ( slotIndex > frozenPtr->numNodes )
+    {
+        return;
+    }
+
+    // fill left subtree slots first
+    fillFrozenSlots( frozenPtr, 2 * slotIndex, inOrderIndexPtr, lastKeyPtr );
+
+    // place next node in order
+    nodePtr = frozenPtr->nodePtrs[ *inOrderIndexPtr ];
+
+    // keyed node sets key, others repeat last key
+    if ( nodePtr->roomKey != NO_ROOM_KEY )
+    {
+        *lastKeyPtr = nodePtr->roomKey;
+    }
+
+    frozenPtr->keyArray[ slotIndex ] = *lastKeyPtr;
+    frozenPtr->payloadIndices[ slotIndex ] = *inOrderIndexPtr;
+    (*inOrderIndexPtr)++;
+
+    // fill right subtree slots
+    fillFrozenSlots( frozenPtr, 2 * slotIndex + 1,
+                                                 inOrderIndexPtr, lastKeyPtr );
+}
+
+unsigned int findLowerBoundSlot(unsigned int slotIndex)
+{
+#if defined( __GNUC__ )
+    // drop trailing ones and the zero above them
+    return slotIndex >> ( __builtin_ctz( ~slotIndex ) + 1 );
+#else
+    // drop trailing ones
+    while ( ( slotIndex & 1 ) != 0 )
+    {
+        slotIndex >>= 1;
+    }
+
+    // drop the zero above them
+    return slotIndex >> 1;
+#endif
+}
+
+FrozenTreeType* freezeTree(AvlTreeNodeType* rootPtr)
+{
+    // initialize variables
+    FrozenTreeType *frozenPtr;
+    unsigned long long lastKey = NO_ROOM_KEY;
+    size_t keyAddress;
+    int numNodes = countTreeNodes( rootPtr ), inOrderIndex = 0;
+
+    // create snapshot
+    frozenPtr = (FrozenTreeType *)malloc( sizeof(FrozenTreeType) );
+    frozenPtr->numNodes = numNodes;
+
+    // collect nodes in order as payload
+    frozenPtr->nodePtrs = (AvlTreeNodeType **)malloc(
+                              ( numNodes + 1 ) * sizeof(AvlTreeNodeType *) );
+    loadInOrderNodes( rootPtr, frozenPtr->nodePtrs, 0 );
+
+    // create key array on cache line boundary, slot zero unused,
+    // so each group of four levels down starts a cache line
+    frozenPtr->keyBlockPtr = malloc( ( numNodes + 1 )
+                  * sizeof(unsigned long long) + FROZEN_KEY_ALIGNMENT );
+    keyAddress = (size_t)frozenPtr->keyBlockPtr + FROZEN_KEY_ALIGNMENT - 1;
+    keyAddress -= keyAddress % FROZEN_KEY_ALIGNMENT;
+    frozenPtr->keyArray = (unsigned long long *)keyAddress;
+
+    // create payload index array, slot zero unused
+    frozenPtr->payloadIndices = (int *)malloc( 
+                                              ( numNodes + 1 ) * sizeof(int) );
+
+    // place nodes into slots
+    fillFrozenSlots( frozenPtr, 1, &inOrderIndex, &lastKey );
+
+    // return new snapshot
+    return frozenPtr;
+}
+
+int loadInOrderNodes(AvlTreeNodeType* wkgPtr, AvlTreeNodeType** nodePtrs,
+                                                                      int index)
+{
+    // check if current node is not null
+    if ( !isEmpty( wkgPtr ) )
+    {
+        // load left, current, then right
+        index = loadInOrderNodes( wkgPtr->leftChildPtr, nodePtrs, index );
+
+        nodePtrs[ index ] = wkgPtr;
+        index++;
+
+        index = loadInOrderNodes( wkgPtr->rightChildPtr, nodePtrs, index );
+    }
+
+    // return next index
+    return index;
+}
+
+AvlTreeNodeType* searchFrozenNodesByString(const FrozenTreeType* frozenPtr,
+                                                        const char* roomNumber)
+{
+    // initialize variables
+    int lowIndex = 0, highIndex = frozenPtr->numNodes - 1;
+    int midIndex, comparisonVal;
+
+    // loop until range is empty
+    while ( lowIndex <= highIndex )
+    {
+        // find comparison with middle node
+        midIndex = lowIndex + ( highIndex - lowIndex ) / 2;
+        comparisonVal = compareRoomKeys( NO_ROOM_KEY, roomNumber,
+                                  frozenPtr->nodePtrs[ midIndex ]->roomKey,
+                                  frozenPtr->nodePtrs[ midIndex ]->roomNumber );
+
+        // check for found
+        if ( comparisonVal == 0 )
+        {
+            // return found node
+            return frozenPtr->nodePtrs[ midIndex ];
+        }
+
+        // keep half that can hold room number
+        if ( comparisonVal > 0 )
+        {
+            lowIndex = midIndex + 1;
+        }
+        else
+        {
+            highIndex = midIndex - 1;
+        }
+    }
+
+    // return not found
+    return NULL;
+}
+
+AvlTreeNodeType* searchFrozenTree(const FrozenTreeType* frozenPtr,
+                                                        const char* roomNumber)
+{
+    // initialize variables
+    unsigned long long searchKey = createRoomKey( roomNumber );
+    const unsigned long long *keyArray = frozenPtr->keyArray;
+    unsigned int slotIndex = 1, numNodes = (unsigned int)frozenPtr->numNodes;
+
+    // check for room number with no packed key
+    if ( searchKey == NO_ROOM_KEY )
+    {
+        // use string comparison instead
+        return searchFrozenNodesByString( frozenPtr, roomNumber );
+    }
+
+    // descend, going right when slot key is less, no branch on compare
+    while ( slotIndex <= numNodes )
+    {
+        // request both cache lines four levels below
+        PREFETCH_READ( keyArray + FROZEN_PREFETCH_STRIDE * slotIndex );
+        PREFETCH_READ( keyArray + FROZEN_PREFETCH_STRIDE * slotIndex
+                                             + FROZEN_PREFETCH_STRIDE / 2 );
+
+        slotIndex = 2 * slotIndex + ( keyArray[ slotIndex ] < searchKey );
+    }
+
+    // find first slot with key not less than search key
+    slotIndex = findLowerBoundSlot( slotIndex );
+
+    // check for match
+    if ( slotIndex != 0 && keyArray[ slotIndex ] == searchKey )
+    {
+        // return payload node
+        return frozenPtr->nodePtrs[ frozenPtr->payloadIndices[ slotIndex ] ];
+    }
+
+    // return not found
+    return NULL;
+}
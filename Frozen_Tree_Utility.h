@@ -0,0 +1,150 @@
+#ifndef FROZEN_TREE_UTILITY_H
+#define FROZEN_TREE_UTILITY_H
+
+// Header files
+#include <stdlib.h>
+#include <stdbool.h>
+#include "AVL_Tree_Utility.h"
+
+// Constants
+
+// keys are grouped so four tree levels below a slot fill two cache lines
+typedef enum { FROZEN_KEY_ALIGNMENT = 64, 
+                                     FROZEN_PREFETCH_STRIDE = 16 } FrozenLayout;
+
+// Data Structures
+
+// keys in Eytzinger (breadth first) order starting at slot 1,
+// payload index of each slot gives the node in the in order node array
+typedef struct FrozenTreeStruct
+   {
+    unsigned long long *keyArray;
+
+    int *payloadIndices;
+
+    AvlTreeNodeType **nodePtrs;
+
+    void *keyBlockPtr;
+
+    int numNodes;
+   } FrozenTreeType;
+
+// Prototypes
+
+/*
+Name: clearFrozenTree
+Process: returns all arrays of frozen snapshot and snapshot itself to OS,
+         tree the snapshot was made from is not changed
+Function input/parameters: frozen snapshot (FrozenTreeType *)
+Function output/parameters: none
+Function output/returned: NULL
+Device input/---: none
+Device output/---: none
+Dependencies: free
+*/
+FrozenTreeType *clearFrozenTree( FrozenTreeType *frozenPtr );
+
+/*
+Name: fillFrozenSlots
+Process: recursively places in order nodes into Eytzinger slots,
+         visiting slots in order so slot keys ascend from left to right;
+         node with no packed key takes key of the node before it
+         so keys never decrease and lower bound search still works
+Function input/parameters: frozen snapshot (FrozenTreeType *),
+                           current slot (int),
+                           next in order index (int *),
+                           last key placed (unsigned long long *)
+Function output/parameters: snapshot with slots filled (FrozenTreeType *),
+                            updated in order index (int *)
+                            and last key (unsigned long long *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: fillFrozenSlots (recursively)
+*/
+void fillFrozenSlots( FrozenTreeType *frozenPtr, int slotIndex,
+                        int *inOrderIndexPtr, unsigned long long *lastKeyPtr );
+
+/*
+Name: findLowerBoundSlot
+Process: recovers slot of lower bound after Eytzinger descent ends
+         past the last level, by dropping trailing right turns
+         and the final left turn from the slot number
+Function input/parameters: slot reached by descent (unsigned int)
+Function output/parameters: none
+Function output/returned: lower bound slot, or zero if all keys are less
+                          (unsigned int)
+Device input/---: none
+Device output/---: none
+Dependencies: __builtin_ctz where available
+*/
+unsigned int findLowerBoundSlot( unsigned int slotIndex );
+
+/*
+Name: freezeTree
+Process: creates read only search snapshot of given tree,
+         keys are stored contiguously in Eytzinger order
+         with no pointers in search path, node pointers are kept
+         in in order array as payload;
+         tree must not be changed or cleared while snapshot is used
+Function input/parameters: tree root (AvlTreeNodeType *)
+Function output/parameters: none
+Function output/returned: new snapshot, empty if tree is empty
+                          (FrozenTreeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: malloc, sizeof, countTreeNodes, loadInOrderNodes,
+              fillFrozenSlots
+*/
+FrozenTreeType *freezeTree( AvlTreeNodeType *rootPtr );
+
+/*
+Name: loadInOrderNodes
+Process: recursively stores node pointers of subtree in in order sequence
+Function input/parameters: subtree root (AvlTreeNodeType *),
+                           array for node pointers (AvlTreeNodeType **),
+                           next array index (int)
+Function output/parameters: array with subtree loaded (AvlTreeNodeType **)
+Function output/returned: next array index after subtree (int)
+Device input/---: none
+Device output/---: none
+Dependencies: isEmpty, loadInOrderNodes (recursively)
+*/
+int loadInOrderNodes( AvlTreeNodeType *wkgPtr, AvlTreeNodeType **nodePtrs,
+                                                                   int index );
+
+/*
+Name: searchFrozenNodesByString
+Process: binary searches in order node array comparing room numbers,
+         used for search room numbers that have no packed key
+Function input/parameters: frozen snapshot (const FrozenTreeType *),
+                           room number (const char *)
+Function output/parameters: none
+Function output/returned: pointer to found node or NULL (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: compareRoomKeys
+*/
+AvlTreeNodeType *searchFrozenNodesByString( const FrozenTreeType *frozenPtr,
+                                                      const char *roomNumber );
+
+/*
+Name: searchFrozenTree
+Process: finds node with given room number in frozen snapshot,
+         descends Eytzinger key array with no branch on comparison,
+         prefetching keys four levels ahead,
+         then checks lower bound slot for match;
+         room numbers with no packed key are searched by string
+Function input/parameters: frozen snapshot (const FrozenTreeType *),
+                           room number (const char *)
+Function output/parameters: none
+Function output/returned: pointer to found node or NULL (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: createRoomKey, searchFrozenNodesByString, PREFETCH_READ,
+              findLowerBoundSlot
+*/
+AvlTreeNodeType *searchFrozenTree( const FrozenTreeType *frozenPtr,
+                                                      const char *roomNumber );
+
+#endif   // FROZEN_TREE_UTILITY_H
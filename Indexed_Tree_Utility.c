@@ -0,0 +1,297 @@
+// header files
+#include "Indexed_Tree_Utility.h"
+
+void addIndexEntry(IndexedTreeType* indexedPtr, AvlTreeNodeType* nodePtr)
+{
+    // initialize variables
+    int slot;
+
+    // check for table too full with one more entry
+    if ( ( indexedPtr->numEntries + 1 ) * 100
+                          > indexedPtr->capacity * MAX_INDEX_LOAD_PERCENT )
+    {
+        resizeTreeIndex( indexedPtr, 2 * indexedPtr->capacity,
+                                                     indexedPtr->shift + 1 );
+    }
+
+    // find entry of room, or empty slot for it
+    slot = findIndexSlot( indexedPtr, nodePtr->roomKey, nodePtr->roomNumber );
+
+    if ( indexedPtr->entries[ slot ].nodePtr == NULL )
+    {
+        indexedPtr->numEntries++;
+    }
+
+    indexedPtr->entries[ slot ].roomKey = nodePtr->roomKey;
+    indexedPtr->entries[ slot ].nodePtr = nodePtr;
+}
+
+IndexedTreeType* clearIndexedTree(IndexedTreeType* indexedPtr)
+{
+    // release tree, table and indexed tree
+    clearTree( indexedPtr->rootPtr );
+    free( indexedPtr->entries );
+    free( indexedPtr );
+
+    // return cleared indexed tree ptr
+    return NULL;
+}
+
+IndexedTreeType* createIndexedTree(AvlTreeNodeType* rootPtr)
+{
+    // initialize variables
+    IndexedTreeType *indexedPtr
+                      = (IndexedTreeType *)malloc( sizeof(IndexedTreeType) );
+
+    // indexed tree owns given tree, table starts empty
+    indexedPtr->rootPtr = rootPtr;
+    indexedPtr->entries = NULL;
+    indexedPtr->capacity = 0;
+    indexedPtr->numEntries = 0;
+    indexedPtr->shift = 0;
+
+    // add every room of tree
+    rebuildTreeIndex( indexedPtr );
+
+    // return new indexed tree
+    return indexedPtr;
+}
+
+int findIndexHash(unsigned long long roomKey, const char* roomNumber,
+                                                                    int shift)
+{
+    // initialize variables
+    unsigned long long hashVal = roomKey;
+
+    // check for room number with no packed key
+    if ( roomKey == NO_ROOM_KEY )
+    {
+        hashVal = findStringHash( roomNumber );
+    }
+
+    // return top bits of product as slot
+    return (int)( ( hashVal * INDEX_HASH_MULTIPLIER ) >> ( 64 - shift ) );
+}
+
+int findIndexSlot(IndexedTreeType* indexedPtr, unsigned long long roomKey,
+                                                     const char* roomNumber)
+{
+    // initialize variables
+    IndexEntryType *entries = indexedPtr->entries;
+    int mask = indexedPtr->capacity - 1;
+    int slot = findIndexHash( roomKey, roomNumber, indexedPtr->shift );
+
+    // loop across probe run until empty slot
+    while ( entries[ slot ].nodePtr != NULL )
+    {
+        // check for entry of room, keys decide unless there is no key
+        if ( entries[ slot ].roomKey == roomKey
+                 && ( roomKey != NO_ROOM_KEY
+                 || isSameString( entries[ slot ].nodePtr->roomNumber,
+                                                             roomNumber ) ) )
+        {
+            return slot;
+        }
+
+        slot = ( slot + 1 ) & mask;
+    }
+
+    // return empty slot
+    return slot;
+}
+
+void insertIndexedTree(IndexedTreeType* indexedPtr,
+    char* rmNmbr, char* bldgRm, char* clsSetup, int capacity)
+{
+    // initialize variables
+    int slot = findIndexSlot( indexedPtr, createRoomKey( rmNmbr ), rmNmbr );
+
+    // check for room already in tree, insert would change nothing
+    if ( indexedPtr->entries[ slot ].nodePtr != NULL )
+    {
+        return;
+    }
+
+    // insert in place, then add new node
+    unshareIndexedTree( indexedPtr );
+
+    indexedPtr->rootPtr = insert( indexedPtr->rootPtr,
+                                         rmNmbr, bldgRm, clsSetup, capacity );
+
+    addIndexEntry( indexedPtr, search( indexedPtr->rootPtr, rmNmbr ) );
+}
+
+void rebuildTreeIndex(IndexedTreeType* indexedPtr)
+{
+    // initialize variables
+    TreeIteratorType iterator;
+    AvlTreeNodeType *nodePtr;
+    int numNodes = countTreeNodes( indexedPtr->rootPtr );
+    int capacity = INITIAL_INDEX_CAPACITY, shift = INITIAL_INDEX_SHIFT;
+
+    // find capacity that holds all rooms without growing
+    while ( numNodes * 100 > capacity * MAX_INDEX_LOAD_PERCENT )
+    {
+        capacity *= 2;
+        shift++;
+    }
+
+    // drop old entries, start from empty table
+    free( indexedPtr->entries );
+    indexedPtr->entries = NULL;
+    indexedPtr->capacity = 0;
+    indexedPtr->numEntries = 0;
+
+    resizeTreeIndex( indexedPtr, capacity, shift );
+
+    // add each node of tree
+    initializeTreeIterator( &iterator, indexedPtr->rootPtr );
+
+    while ( ( nodePtr = getNextTreeNode( &iterator ) ) != NULL )
+    {
+        addIndexEntry( indexedPtr, nodePtr );
+    }
+}
+
+void removeFromIndexedTree(IndexedTreeType* indexedPtr, const char* roomNumber)
+{
+    // initialize variables
+    int slot;
+
+    // removal is in place, so other entries stay valid
+    unshareIndexedTree( indexedPtr );
+
+    slot = findIndexSlot( indexedPtr, createRoomKey( roomNumber ),
+                                                                roomNumber );
+
+    // check for room not in tree
+    if ( indexedPtr->entries[ slot ].nodePtr == NULL )
+    {
+        return;
+    }
+
+    // remove from tree, then from table
+    indexedPtr->rootPtr = removeNode( indexedPtr->rootPtr, roomNumber );
+
+    removeIndexEntry( indexedPtr, slot );
+}
+
+void removeIndexEntry(IndexedTreeType* indexedPtr, int slot)
+{
+    // initialize variables
+    IndexEntryType *entries = indexedPtr->entries;
+    int mask = indexedPtr->capacity - 1;
+    int nextSlot = ( slot + 1 ) & mask;
+    int homeSlot;
+
+    // empty slot of entry
+    entries[ slot ].nodePtr = NULL;
+    indexedPtr->numEntries--;
+
+    // loop across rest of probe run
+    while ( entries[ nextSlot ].nodePtr != NULL )
+    {
+        homeSlot = findIndexHash( entries[ nextSlot ].roomKey,
+                                   entries[ nextSlot ].nodePtr->roomNumber,
+                                                         indexedPtr->shift );
+
+        // check for entry whose home is at or before emptied slot,
+        // it is still found after moving back into it
+        if ( ( ( nextSlot - homeSlot ) & mask )
+                                          >= ( ( nextSlot - slot ) & mask ) )
+        {
+            entries[ slot ] = entries[ nextSlot ];
+            entries[ nextSlot ].nodePtr = NULL;
+            slot = nextSlot;
+        }
+
+        nextSlot = ( nextSlot + 1 ) & mask;
+    }
+}
+
+void resizeTreeIndex(IndexedTreeType* indexedPtr, int newCapacity,
+                                                                int newShift)
+{
+    // initialize variables
+    IndexEntryType *oldEntries = indexedPtr->entries;
+    int oldCapacity = indexedPtr->capacity;
+    int index, slot;
+
+    // create empty table
+    indexedPtr->entries = (IndexEntryType *)malloc(
+                                        newCapacity * sizeof(IndexEntryType) );
+    indexedPtr->capacity = newCapacity;
+    indexedPtr->shift = newShift;
+
+    for ( index = 0; index < newCapacity; index++ )
+    {
+        indexedPtr->entries[ index ].nodePtr = NULL;
+    }
+
+    // add old entries again, count is unchanged
+    for ( index = 0; index < oldCapacity; index++ )
+    {
+        if ( oldEntries[ index ].nodePtr != NULL )
+        {
+            slot = findIndexSlot( indexedPtr, oldEntries[ index ].roomKey,
+                                     oldEntries[ index ].nodePtr->roomNumber );
+            indexedPtr->entries[ slot ] = oldEntries[ index ];
+        }
+    }
+
+    free( oldEntries );
+}
+
+AvlTreeNodeType* searchIndexedTree(IndexedTreeType* indexedPtr,
+                                                        const char* roomNumber)
+{
+    // initialize variables
+    int slot = findIndexSlot( indexedPtr, createRoomKey( roomNumber ),
+                                                                roomNumber );
+
+    // return node of entry, NULL for empty slot
+    return indexedPtr->entries[ slot ].nodePtr;
+}
+
+void unshareIndexedTree(IndexedTreeType* indexedPtr)
+{
+    // initialize variables
+    AvlTreeNodeType *ownRootPtr;
+
+    // check for tree sharing nodes with copies
+    if ( !isEmpty( indexedPtr->rootPtr )
+                         && indexedPtr->rootPtr->arenaPtr->numVersions > 1 )
+    {
+        // copy whole tree once, copies keep shared version
+        ownRootPtr = copyTreeDeep( indexedPtr->rootPtr );
+        clearTree( indexedPtr->rootPtr );
+        indexedPtr->rootPtr = ownRootPtr;
+
+        // every room is in a new node
+        rebuildTreeIndex( indexedPtr );
+    }
+}
+
+void upsertIndexedTree(IndexedTreeType* indexedPtr,
+    char* rmNmbr, char* bldgRm, char* clsSetup, int capacity)
+{
+    // initialize variables
+    AvlTreeNodeType *foundPtr;
+
+    // change is in place, so node found stays in tree
+    unshareIndexedTree( indexedPtr );
+
+    foundPtr = searchIndexedTree( indexedPtr, rmNmbr );
+
+    // check for room found
+    if ( foundPtr != NULL )
+    {
+        // update node, tree shape is unchanged
+        updateNodeData( foundPtr, bldgRm, clsSetup, capacity );
+    }
+    // otherwise, add room
+    else
+    {
+        insertIndexedTree( indexedPtr, rmNmbr, bldgRm, clsSetup, capacity );
+    }
+}
@@ -0,0 +1,244 @@
+#ifndef INDEXED_TREE_UTILITY_H
+#define INDEXED_TREE_UTILITY_H
+
+// Header files
+#include <stdlib.h>
+#include <stdbool.h>
+#include "AVL_Tree_Utility.h"
+
+// Constants
+
+// table grows to twice its size before it is more than 70 percent full
+typedef enum { INITIAL_INDEX_CAPACITY = 64, INITIAL_INDEX_SHIFT = 6,
+                                      MAX_INDEX_LOAD_PERCENT = 70 } IndexLimits;
+
+// Fibonacci hashing multiplier, spreads packed keys whose low bits are
+// always zero over the high bits used as slot number
+#define INDEX_HASH_MULTIPLIER 0x9E3779B97F4A7C15ULL
+
+// Data Structures
+
+// one slot, a room's packed key kept with its node so most probes
+// never touch a node; empty slots have NULL node
+typedef struct IndexEntryStruct
+   {
+    unsigned long long roomKey;
+
+    AvlTreeNodeType *nodePtr;
+   } IndexEntryType;
+
+// tree with open addressing table from room number to node, linear
+// probing, removals shift later entries back so no slot is left marked;
+// ordered operations use the tree at rootPtr as is, all changes go
+// through this module so table and tree hold the same rooms, and
+// entries stay valid since changes in place never move a room's node
+typedef struct IndexedTreeStruct
+   {
+    AvlTreeNodeType *rootPtr;
+
+    IndexEntryType *entries;
+
+    int capacity, numEntries, shift;
+   } IndexedTreeType;
+
+// Prototypes
+
+/*
+Name: addIndexEntry
+Process: adds node to table, or points existing entry of its room at it,
+         growing table first when it would become too full
+Function input/parameters: indexed tree (IndexedTreeType *),
+                           node (AvlTreeNodeType *)
+Function output/parameters: indexed tree with entry (IndexedTreeType *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: resizeTreeIndex, findIndexSlot
+*/
+void addIndexEntry( IndexedTreeType *indexedPtr, AvlTreeNodeType *nodePtr );
+
+/*
+Name: clearIndexedTree
+Process: releases tree and table, and indexed tree itself
+Function input/parameters: indexed tree (IndexedTreeType *)
+Function output/parameters: none
+Function output/returned: NULL
+Device input/---: none
+Device output/---: none
+Dependencies: clearTree, free
+*/
+IndexedTreeType *clearIndexedTree( IndexedTreeType *indexedPtr );
+
+/*
+Name: createIndexedTree
+Process: creates indexed tree owning given tree, which may be empty,
+         with table sized for its rooms
+Function input/parameters: tree root (AvlTreeNodeType *)
+Function output/parameters: none
+Function output/returned: new indexed tree (IndexedTreeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: malloc, sizeof, rebuildTreeIndex
+*/
+IndexedTreeType *createIndexedTree( AvlTreeNodeType *rootPtr );
+
+/*
+Name: findIndexHash
+Process: finds home slot of room: high bits of packed key times
+         INDEX_HASH_MULTIPLIER, or of string hash for room number
+         with no packed key
+Function input/parameters: packed key (unsigned long long),
+                           room number (const char *),
+                           bits in slot number (int)
+Function output/parameters: none
+Function output/returned: home slot (int)
+Device input/---: none
+Device output/---: none
+Dependencies: findStringHash
+*/
+int findIndexHash( unsigned long long roomKey, const char *roomNumber,
+                                                                  int shift );
+
+/*
+Name: findIndexSlot
+Process: probes from home slot of room to its entry, or to the empty
+         slot where its entry would go; room number is compared only
+         for rooms with no packed key
+Function input/parameters: indexed tree (IndexedTreeType *),
+                           packed key (unsigned long long),
+                           room number (const char *)
+Function output/parameters: none
+Function output/returned: slot of entry or empty slot (int)
+Device input/---: none
+Device output/---: none
+Dependencies: findIndexHash, isSameString
+*/
+int findIndexSlot( IndexedTreeType *indexedPtr, unsigned long long roomKey,
+                                                   const char *roomNumber );
+
+/*
+Name: insertIndexedTree
+Process: inserts room as insert does and adds its node to table; room
+         already in table changes nothing and needs no tree search
+Function input/parameters: indexed tree (IndexedTreeType *),
+                           room number, building room data, class setup
+                           (char *), capacity (int)
+Function output/parameters: indexed tree with room (IndexedTreeType *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: createRoomKey, findIndexSlot, unshareIndexedTree, insert,
+              search, addIndexEntry
+*/
+void insertIndexedTree( IndexedTreeType *indexedPtr,
+                     char *rmNmbr, char *bldgRm, char *clsSetup, int capacity );
+
+/*
+Name: rebuildTreeIndex
+Process: empties table and adds every node of tree again, used when
+         tree is replaced or its nodes have moved
+Function input/parameters: indexed tree (IndexedTreeType *)
+Function output/parameters: indexed tree, table matching tree
+                            (IndexedTreeType *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: countTreeNodes, resizeTreeIndex, initializeTreeIterator,
+              getNextTreeNode, addIndexEntry
+*/
+void rebuildTreeIndex( IndexedTreeType *indexedPtr );
+
+/*
+Name: removeFromIndexedTree
+Process: removes room as removeNode does and drops its entry, entries
+         after it in its probe run shift back to fill the slot
+Function input/parameters: indexed tree (IndexedTreeType *),
+                           room number (const char *)
+Function output/parameters: indexed tree without room (IndexedTreeType *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: createRoomKey, findIndexSlot, unshareIndexedTree,
+              removeNode, removeIndexEntry
+*/
+void removeFromIndexedTree( IndexedTreeType *indexedPtr,
+                                                      const char *roomNumber );
+
+/*
+Name: removeIndexEntry
+Process: empties slot, then moves back each later entry of the probe run
+         whose home slot is not between emptied slot and itself
+Function input/parameters: indexed tree (IndexedTreeType *),
+                           slot of entry (int)
+Function output/parameters: indexed tree without entry (IndexedTreeType *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: findIndexHash
+*/
+void removeIndexEntry( IndexedTreeType *indexedPtr, int slot );
+
+/*
+Name: resizeTreeIndex
+Process: replaces table with empty one of given power of two capacity,
+         then adds entries of old table again
+Function input/parameters: indexed tree (IndexedTreeType *),
+                           new capacity, new bits in slot number (int)
+Function output/parameters: indexed tree with new table
+                            (IndexedTreeType *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: malloc, sizeof, findIndexSlot, free
+*/
+void resizeTreeIndex( IndexedTreeType *indexedPtr, int newCapacity,
+                                                              int newShift );
+
+/*
+Name: searchIndexedTree
+Process: finds room by table alone, no tree search
+Function input/parameters: indexed tree (IndexedTreeType *),
+                           room number (const char *)
+Function output/parameters: none
+Function output/returned: pointer to found node or NULL (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: createRoomKey, findIndexSlot
+*/
+AvlTreeNodeType *searchIndexedTree( IndexedTreeType *indexedPtr,
+                                                      const char *roomNumber );
+
+/*
+Name: unshareIndexedTree
+Process: gives indexed tree nodes of its own when it shares them with
+         copyTree copies: changes would copy nodes on their path and so
+         move rooms to new nodes, so tree is deep copied once, its shared
+         version released, and table rebuilt; later changes are in place
+Function input/parameters: indexed tree (IndexedTreeType *)
+Function output/parameters: indexed tree sharing no nodes
+                            (IndexedTreeType *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: isEmpty, copyTreeDeep, clearTree, rebuildTreeIndex
+*/
+void unshareIndexedTree( IndexedTreeType *indexedPtr );
+
+/*
+Name: upsertIndexedTree
+Process: updates room found by table in place with no tree search,
+         or inserts it as insertIndexedTree does
+Function input/parameters: indexed tree (IndexedTreeType *),
+                           room number, building room data, class setup
+                           (char *), capacity (int)
+Function output/parameters: indexed tree with room (IndexedTreeType *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: searchIndexedTree, unshareIndexedTree, updateNodeData,
+              insertIndexedTree
+*/
+void upsertIndexedTree( IndexedTreeType *indexedPtr,
+                     char *rmNmbr, char *bldgRm, char *clsSetup, int capacity );
+
+#endif   // INDEXED_TREE_UTILITY_H
@@ -0,0 +1,356 @@
+/*
+Leveled logging utility, function implementations
+*/
+
+// header files
+#include "Logging_Utility.h"
+#include <stdarg.h>
+#include <stdlib.h>
+
+    /*
+    Name: accessLogger
+    process: provides logger used by all log functions;
+             note: logger is maintained (static) value initialized to
+             runtime level LOG_LEVEL_INFO and no sink thread
+    Function input/parameters: none
+    Function output/parameters: none
+    Function output/returned: pointer to logger (LoggerType *)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    LoggerType *accessLogger()
+       {
+        // initialize logger to info level, messages written directly
+        static LoggerType logger = { LOG_LEVEL_INFO, false, false,
+                                     PTHREAD_MUTEX_INITIALIZER,
+                                     PTHREAD_COND_INITIALIZER,
+                                     PTHREAD_COND_INITIALIZER };
+
+        // return logger
+        return &logger;
+       }
+
+    /*
+    Name: checkLogLevel
+    process: tests whether messages at given level are shown at runtime
+    Function input/parameters: log level (int)
+    Function output/parameters: none
+    Function output/returned: Boolean result of test (bool)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: accessLogger
+    */
+    bool checkLogLevel( int level )
+       {
+        // return test against runtime level
+           // function: accessLogger
+        return level >= accessLogger()->runtimeLevel;
+       }
+
+    /*
+    Name: closeLogSink
+    process: stops sink thread after it writes all queued messages,
+             releases queue, later messages are written directly;
+             returns true if sink thread was running, false otherwise
+    Function input/parameters: none
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/file: remaining messages written
+    Dependencies: accessLogger, pthread_mutex_lock, pthread_cond_signal,
+                  pthread_mutex_unlock, pthread_join, closeBufferedWriter,
+                  free
+    */
+    bool closeLogSink()
+       {
+        // initialize variables
+        LoggerType *loggerPtr = accessLogger();
+
+        // check for sink thread not running
+        if( !loggerPtr->asyncFlag )
+           {
+            // return failed operation
+            return false;
+           }
+
+        // ask sink thread to finish queue and stop
+           // function: pthread_mutex_lock, pthread_cond_signal,
+           //           pthread_mutex_unlock, pthread_join
+        pthread_mutex_lock( &loggerPtr->loggerLock );
+        loggerPtr->stopFlag = true;
+        pthread_cond_signal( &loggerPtr->queuedCondition );
+        pthread_mutex_unlock( &loggerPtr->loggerLock );
+
+        pthread_join( loggerPtr->sinkThread, NULL );
+
+        // return to direct writes, release queue
+           // function: closeBufferedWriter, free
+        pthread_mutex_lock( &loggerPtr->loggerLock );
+        loggerPtr->asyncFlag = false;
+        loggerPtr->stopFlag = false;
+        closeBufferedWriter( &loggerPtr->writer );
+        free( loggerPtr->messageRing );
+        loggerPtr->messageRing = NULL;
+        pthread_cond_broadcast( &loggerPtr->spaceCondition );
+        pthread_mutex_unlock( &loggerPtr->loggerLock );
+
+        // return successful operation
+        return true;
+       }
+
+    /*
+    Name: findLogLevelName
+    process: finds name shown at start of messages of given level
+    Function input/parameters: log level (int)
+    Function output/parameters: none
+    Function output/returned: level name (const char *)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    const char *findLogLevelName( int level )
+       {
+        // initialize variables
+        static const char *levelNames[] = { "TRACE", "DEBUG", "INFO",
+                                            "WARN", "ERROR" };
+
+        // check for level out of range
+        if( level < LOG_LEVEL_TRACE || level > LOG_LEVEL_ERROR )
+           {
+            return "LOG";
+           }
+
+        // return name
+        return levelNames[ level ];
+       }
+
+    /*
+    Name: logMessage
+    process: formats message with level name and queues it for sink
+             thread, waiting if queue is full, or writes it directly
+             if no sink thread runs; messages longer than
+             LOG_MESSAGE_CAPACITY are cut short;
+             normally used through LOG_ macros, which test level first
+    Function input/parameters: log level (int), printf style format
+                               (const char *), values for format
+    Function output/parameters: none
+    Function output/returned: none
+    Device input/file: none
+    Device output/monitor: message displayed when written
+    Dependencies: findLogLevelName, snprintf, vsnprintf, accessLogger,
+                  pthread_mutex_lock, pthread_cond_wait,
+                  pthread_cond_signal, pthread_mutex_unlock, fputs
+    */
+    void logMessage( int level, const char *format, ... )
+       {
+        // initialize variables
+        LoggerType *loggerPtr = accessLogger();
+        char message[ LOG_MESSAGE_CAPACITY ];
+        char *slotPtr;
+        va_list valueList;
+        int index;
+
+        // format level name then message, outside lock
+           // function: findLogLevelName, snprintf, vsnprintf
+        index = snprintf( message, LOG_MESSAGE_CAPACITY, "[%s] ",
+                                                  findLogLevelName( level ) );
+
+        va_start( valueList, format );
+        vsnprintf( message + index, LOG_MESSAGE_CAPACITY - index,
+                                                         format, valueList );
+        va_end( valueList );
+
+        // wait for room while sink thread runs
+           // function: pthread_mutex_lock, pthread_cond_wait
+        pthread_mutex_lock( &loggerPtr->loggerLock );
+
+        while( loggerPtr->asyncFlag
+                           && loggerPtr->numQueued == LOG_QUEUE_CAPACITY )
+           {
+            pthread_cond_wait( &loggerPtr->spaceCondition,
+                                                     &loggerPtr->loggerLock );
+           }
+
+        // check for sink thread running
+        if( loggerPtr->asyncFlag )
+           {
+            // copy message into next free slot
+            slotPtr = loggerPtr->messageRing[ ( loggerPtr->headIndex
+                     + loggerPtr->numQueued ) % LOG_QUEUE_CAPACITY ];
+
+            for( index = 0; message[ index ] != NULL_CHAR; index++ )
+               {
+                slotPtr[ index ] = message[ index ];
+               }
+
+            slotPtr[ index ] = NULL_CHAR;
+
+            // tell sink thread
+               // function: pthread_cond_signal
+            loggerPtr->numQueued++;
+            pthread_cond_signal( &loggerPtr->queuedCondition );
+           }
+
+        // otherwise, write message now
+        else
+           {
+               // function: fputs
+            fputs( message, stdout );
+            fputs( "\n", stdout );
+           }
+
+           // function: pthread_mutex_unlock
+        pthread_mutex_unlock( &loggerPtr->loggerLock );
+       }
+
+    /*
+    Name: openLogSink
+    process: starts sink thread writing queued messages to given stream
+             in blocks; returns true if started, false if already
+             running or thread could not be started
+    Function input/parameters: open stream (FILE *)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: accessLogger, malloc, initializeBufferedWriter,
+                  openBufferedWriterToStream, pthread_create,
+                  closeBufferedWriter, free
+    */
+    bool openLogSink( FILE *streamPtr )
+       {
+        // initialize variables
+        LoggerType *loggerPtr = accessLogger();
+        bool success = false;
+
+           // function: pthread_mutex_lock
+        pthread_mutex_lock( &loggerPtr->loggerLock );
+
+        // check for sink thread not running
+        if( !loggerPtr->asyncFlag )
+           {
+            // create empty queue and writer on stream
+               // function: malloc, initializeBufferedWriter,
+               //           openBufferedWriterToStream
+            loggerPtr->messageRing = malloc( LOG_QUEUE_CAPACITY
+                                      * sizeof( *loggerPtr->messageRing ) );
+            loggerPtr->headIndex = 0;
+            loggerPtr->numQueued = 0;
+            loggerPtr->stopFlag = false;
+
+            initializeBufferedWriter( &loggerPtr->writer );
+            openBufferedWriterToStream( &loggerPtr->writer, streamPtr );
+
+            // start sink thread
+               // function: pthread_create
+            success = pthread_create( &loggerPtr->sinkThread, NULL,
+                                                  runLogSink, loggerPtr ) == 0;
+
+            // check for thread not started
+            if( !success )
+               {
+                // release queue and writer
+                   // function: closeBufferedWriter, free
+                closeBufferedWriter( &loggerPtr->writer );
+                free( loggerPtr->messageRing );
+                loggerPtr->messageRing = NULL;
+               }
+
+            loggerPtr->asyncFlag = success;
+           }
+
+           // function: pthread_mutex_unlock
+        pthread_mutex_unlock( &loggerPtr->loggerLock );
+
+        // return result of operation
+        return success;
+       }
+
+    /*
+    Name: runLogSink
+    process: thread function, waits for queued messages, moves all
+             of them into writer buffer at once, then writes buffer
+             outside lock; ends when stopped and queue is empty
+    Function input/parameters: logger (void *)
+    Function output/parameters: none
+    Function output/returned: NULL (void *)
+    Device input/file: none
+    Device output/file: queued messages written
+    Dependencies: pthread_mutex_lock, pthread_cond_wait,
+                  pthread_cond_broadcast, pthread_mutex_unlock,
+                  writeStringToBufferedWriter,
+                  writeCharacterToBufferedWriter, flushBufferedWriter
+    */
+    void *runLogSink( void *loggerPtr )
+       {
+        // initialize variables
+        LoggerType *logPtr = (LoggerType *)loggerPtr;
+
+        // loop until stopped with nothing queued
+        while( true )
+           {
+            // wait for messages or stop request
+               // function: pthread_mutex_lock, pthread_cond_wait
+            pthread_mutex_lock( &logPtr->loggerLock );
+
+            while( logPtr->numQueued == 0 && !logPtr->stopFlag )
+               {
+                pthread_cond_wait( &logPtr->queuedCondition,
+                                                        &logPtr->loggerLock );
+               }
+
+            // check for stop with queue empty
+            if( logPtr->numQueued == 0 )
+               {
+                   // function: pthread_mutex_unlock
+                pthread_mutex_unlock( &logPtr->loggerLock );
+
+                // return from thread
+                return NULL;
+               }
+
+            // move every queued message into writer buffer
+               // function: writeStringToBufferedWriter,
+               //           writeCharacterToBufferedWriter
+            while( logPtr->numQueued > 0 )
+               {
+                writeStringToBufferedWriter( &logPtr->writer,
+                                  logPtr->messageRing[ logPtr->headIndex ] );
+                writeCharacterToBufferedWriter( &logPtr->writer,
+                                                               NEWLINE_CHAR );
+
+                logPtr->headIndex = ( logPtr->headIndex + 1 ) 
+                                                        % LOG_QUEUE_CAPACITY;
+                logPtr->numQueued--;
+               }
+
+            // let waiting callers continue
+               // function: pthread_cond_broadcast, pthread_mutex_unlock
+            pthread_cond_broadcast( &logPtr->spaceCondition );
+            pthread_mutex_unlock( &logPtr->loggerLock );
+
+            // write messages without holding lock
+               // function: flushBufferedWriter
+            flushBufferedWriter( &logPtr->writer );
+           }
+       }
+
+    /*
+    Name: setLogLevel
+    process: sets lowest level shown at runtime,
+             LOG_LEVEL_OFF shows nothing
+    Function input/parameters: log level (int)
+    Function output/parameters: none
+    Function output/returned: none
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: accessLogger
+    */
+    void setLogLevel( int level )
+       {
+        // set runtime level
+           // function: accessLogger
+        accessLogger()->runtimeLevel = level;
+       }
+
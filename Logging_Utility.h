@@ -0,0 +1,243 @@
+/*
+Leveled logging utility, function prototypes
+*/
+/*
+Rev 0.0: Initial creation of file
+
+UTILITY USAGE INSTRUCTIONS:
+
+1) This utility provides leveled log messages for the C programming
+   language. Messages are written with the LOG_TRACE through LOG_ERROR
+   macros, each a printf style format and values, one line per message.
+
+2) Levels below LOG_COMPILE_LEVEL are removed by the preprocessor,
+   so their values are not even computed; build with
+   -DLOG_COMPILE_LEVEL=0 to keep trace messages.
+   Remaining messages are shown only at or above the runtime level
+   set with setLogLevel, LOG_LEVEL_INFO to start.
+
+3) Messages are written directly to standard output, or, once
+   openLogSink is called, queued and written in blocks by a separate
+   sink thread until closeLogSink is called.
+
+4) Specifications for all the functions
+    are provided in a standardized format below.
+
+   END OF INSTRUCTIONS
+*/
+
+// PreProcessor test
+#ifndef LOGGING_UTILITY_H
+#define LOGGING_UTILITY_H
+
+// header files
+#include <stdbool.h>
+#include <stdio.h>
+#include <pthread.h>
+#include "StandardConstants.h"
+#include "File_Output_Utility.h"
+
+// log levels, defined for preprocessor tests
+#define LOG_LEVEL_TRACE 0
+#define LOG_LEVEL_DEBUG 1
+#define LOG_LEVEL_INFO 2
+#define LOG_LEVEL_WARN 3
+#define LOG_LEVEL_ERROR 4
+#define LOG_LEVEL_OFF 5
+
+// lowest level compiled into program
+#ifndef LOG_COMPILE_LEVEL
+#define LOG_COMPILE_LEVEL LOG_LEVEL_DEBUG
+#endif
+
+// test for level both compiled in and enabled at runtime
+#define LOG_ENABLED( level ) \
+            ( LOG_COMPILE_LEVEL <= ( level ) && checkLogLevel( level ) )
+
+// message at level, shown if enabled at runtime
+#define LOG_AT_LEVEL( level, ... ) \
+            do { if( checkLogLevel( level ) ) \
+                    { logMessage( level, __VA_ARGS__ ); } } while( false )
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_TRACE
+#define LOG_TRACE( ... ) LOG_AT_LEVEL( LOG_LEVEL_TRACE, __VA_ARGS__ )
+#else
+#define LOG_TRACE( ... ) ( (void)0 )
+#endif
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_DEBUG
+#define LOG_DEBUG( ... ) LOG_AT_LEVEL( LOG_LEVEL_DEBUG, __VA_ARGS__ )
+#else
+#define LOG_DEBUG( ... ) ( (void)0 )
+#endif
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_INFO
+#define LOG_INFO( ... ) LOG_AT_LEVEL( LOG_LEVEL_INFO, __VA_ARGS__ )
+#else
+#define LOG_INFO( ... ) ( (void)0 )
+#endif
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_WARN
+#define LOG_WARN( ... ) LOG_AT_LEVEL( LOG_LEVEL_WARN, __VA_ARGS__ )
+#else
+#define LOG_WARN( ... ) ( (void)0 )
+#endif
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_ERROR
+#define LOG_ERROR( ... ) LOG_AT_LEVEL( LOG_LEVEL_ERROR, __VA_ARGS__ )
+#else
+#define LOG_ERROR( ... ) ( (void)0 )
+#endif
+
+// constants shared with other files
+
+    // longest message kept, including level name, and messages queued
+    typedef enum { LOG_MESSAGE_CAPACITY = HUGE_STR_LEN,
+                   LOG_QUEUE_CAPACITY = 1024 } LogCapacities;
+
+// data structures
+
+    // runtime level and queue shared with sink thread,
+    // messages are queued only while sink thread runs
+    typedef struct LoggerStruct
+       {
+        int runtimeLevel;
+
+        bool asyncFlag, stopFlag;
+
+        pthread_mutex_t loggerLock;
+
+        pthread_cond_t queuedCondition, spaceCondition;
+
+        char ( *messageRing )[ LOG_MESSAGE_CAPACITY ];
+
+        int headIndex, numQueued;
+
+        BufferedOutputWriterType writer;
+
+        pthread_t sinkThread;
+       } LoggerType;
+
+// function prototypes
+
+    /*
+    Name: accessLogger
+    process: provides logger used by all log functions;
+             note: logger is maintained (static) value initialized to
+             runtime level LOG_LEVEL_INFO and no sink thread
+    Function input/parameters: none
+    Function output/parameters: none
+    Function output/returned: pointer to logger (LoggerType *)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    LoggerType *accessLogger();
+
+    /*
+    Name: checkLogLevel
+    process: tests whether messages at given level are shown at runtime
+    Function input/parameters: log level (int)
+    Function output/parameters: none
+    Function output/returned: Boolean result of test (bool)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: accessLogger
+    */
+    bool checkLogLevel( int level );
+
+    /*
+    Name: closeLogSink
+    process: stops sink thread after it writes all queued messages,
+             releases queue, later messages are written directly;
+             returns true if sink thread was running, false otherwise
+    Function input/parameters: none
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/file: remaining messages written
+    Dependencies: accessLogger, pthread_mutex_lock, pthread_cond_signal,
+                  pthread_mutex_unlock, pthread_join, closeBufferedWriter,
+                  free
+    */
+    bool closeLogSink();
+
+    /*
+    Name: findLogLevelName
+    process: finds name shown at start of messages of given level
+    Function input/parameters: log level (int)
+    Function output/parameters: none
+    Function output/returned: level name (const char *)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: none
+    */
+    const char *findLogLevelName( int level );
+
+    /*
+    Name: logMessage
+    process: formats message with level name and queues it for sink
+             thread, waiting if queue is full, or writes it directly
+             if no sink thread runs; messages longer than
+             LOG_MESSAGE_CAPACITY are cut short;
+             normally used through LOG_ macros, which test level first
+    Function input/parameters: log level (int), printf style format
+                               (const char *), values for format
+    Function output/parameters: none
+    Function output/returned: none
+    Device input/file: none
+    Device output/monitor: message displayed when written
+    Dependencies: findLogLevelName, snprintf, vsnprintf, accessLogger,
+                  pthread_mutex_lock, pthread_cond_wait,
+                  pthread_cond_signal, pthread_mutex_unlock, fputs
+    */
+    void logMessage( int level, const char *format, ... );
+
+    /*
+    Name: openLogSink
+    process: starts sink thread writing queued messages to given stream
+             in blocks; returns true if started, false if already
+             running or thread could not be started
+    Function input/parameters: open stream (FILE *)
+    Function output/parameters: none
+    Function output/returned: success of operation (bool)
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: accessLogger, malloc, initializeBufferedWriter,
+                  openBufferedWriterToStream, pthread_create,
+                  closeBufferedWriter, free
+    */
+    bool openLogSink( FILE *streamPtr );
+
+    /*
+    Name: runLogSink
+    process: thread function, waits for queued messages, moves all
+             of them into writer buffer at once, then writes buffer
+             outside lock; ends when stopped and queue is empty
+    Function input/parameters: logger (void *)
+    Function output/parameters: none
+    Function output/returned: NULL (void *)
+    Device input/file: none
+    Device output/file: queued messages written
+    Dependencies: pthread_mutex_lock, pthread_cond_wait,
+                  pthread_cond_broadcast, pthread_mutex_unlock,
+                  writeStringToBufferedWriter,
+                  writeCharacterToBufferedWriter, flushBufferedWriter
+    */
+    void *runLogSink( void *loggerPtr );
+
+    /*
+    Name: setLogLevel
+    process: sets lowest level shown at runtime,
+             LOG_LEVEL_OFF shows nothing
+    Function input/parameters: log level (int)
+    Function output/parameters: none
+    Function output/returned: none
+    Device input/file: none
+    Device output/monitor: none
+    Dependencies: accessLogger
+    */
+    void setLogLevel( int level );
+
+#endif  // LOGGING_UTILITY_H
+
@@ -0,0 +1,580 @@
+// header files
+#include "Room_Data_Utility.h"
+
+/*
+Name: getDataFromFile
+Process: uploads data from file with unknown number of data sets,
+         records are buffered, then bulk loaded in linear time
+         if tree is empty, otherwise inserted one at a time,
+         records are listed at debug log level, inserts at trace level
+Function input/parameters: file name (char *)
+Function output/parameters: root pointer (TreeNodeType **)
+Function output/returned: number of values found (int)
+Device input/file: data from HD
+Device output/monitor: none
+Dependencies: LOG_ENABLED, LOG_DEBUG, LOG_TRACE, readRoomRecordsFromFile, 
+              buildTreeFromRecordArray, insert, free
+*/
+int getDataFromFile( const char *fileName, AvlTreeNodeType **rootPtr )
+   {
+    RoomRecordType *recordArray;
+    int index, recordIndex;
+    bool verbose = LOG_ENABLED( LOG_LEVEL_DEBUG );
+
+    LOG_DEBUG( "----- Verbose: Begin Loading Data From File" );
+
+    index = readRoomRecordsFromFile( fileName, &recordArray, verbose );
+
+    // file not found
+    if( index < 0 )
+       {
+        *rootPtr = NULL;
+
+        return 0;
+       }
+
+    // empty tree is built directly from buffered records
+    if( isEmpty( *rootPtr ) )
+       {
+        *rootPtr = buildTreeFromRecordArray( recordArray, index );
+       }
+
+    // otherwise, add records to existing tree
+    else
+       {
+        for( recordIndex = 0; recordIndex < index; recordIndex++ )
+           {
+            LOG_TRACE( "%3d) Inserting %s and balancing", 
+                     recordIndex + 1, recordArray[ recordIndex ].roomNumber );
+
+            *rootPtr = insert( *rootPtr, 
+                               recordArray[ recordIndex ].roomNumber, 
+                               recordArray[ recordIndex ].buildingRoom, 
+                               recordArray[ recordIndex ].classSetup, 
+                               recordArray[ recordIndex ].roomCapacity );
+           }
+       }
+
+    free( recordArray );
+
+    LOG_DEBUG( "----- Verbose: End Loading Data From File" );
+
+    return index;
+   }
+
+/*
+Name: getDataFromFiles
+Process: uploads data from several files into one tree,
+         files are parsed and put in order on up to the given number
+         of threads, sorted runs are then merged in file order so a
+         room number found in more than one file keeps the record from
+         the earliest file, as loading the files one after another does;
+         empty tree is bulk loaded, otherwise records are inserted,
+         files not found are skipped; calling thread loads all files
+         if no thread starts
+Function input/parameters: file names (const char **), number of files (int),
+                           number of threads (int)
+Function output/parameters: root pointer (AvlTreeNodeType **)
+Function output/returned: number of values found in all files (int)
+Device input/file: data from HD
+Device output/monitor: none
+Dependencies: malloc, sizeof, pthread_mutex_init, pthread_create, 
+              loadRoomFileRuns, pthread_join, pthread_mutex_destroy,
+              mergeRoomFileRuns, buildTreeFromSortedArray, createNodeArena,
+              insert, free
+*/
+int getDataFromFiles( const char **fileNames, int numFiles, int numThreads,
+                                                     AvlTreeNodeType **rootPtr )
+   {
+    RoomFileQueueType fileQueue;
+    pthread_t *threadArray;
+    RoomRecordType **mergedPtrs;
+    int numStarted = 0, index, mergedCount, totalCount = 0;
+
+    // check for no files
+    if( numFiles <= 0 )
+       {
+        return 0;
+       }
+
+    // set up queue with one run per file
+    fileQueue.runArray = (RoomFileRunType *)malloc( 
+                                        numFiles * sizeof( RoomFileRunType ) );
+    fileQueue.numFiles = numFiles;
+    fileQueue.nextFileIndex = 0;
+    pthread_mutex_init( &fileQueue.queueLock, NULL );
+
+    for( index = 0; index < numFiles; index++ )
+       {
+        fileQueue.runArray[ index ].fileName = fileNames[ index ];
+       }
+
+    // no more threads than files, at least one
+    numThreads = findMax( 1, findMin( numThreads, numFiles ) );
+
+    threadArray = (pthread_t *)malloc( numThreads * sizeof( pthread_t ) );
+
+    // start workers
+    for( index = 0; index < numThreads; index++ )
+       {
+        // check for worker started
+        if( pthread_create( &threadArray[ numStarted ], NULL, 
+                                        loadRoomFileRuns, &fileQueue ) == 0 )
+           {
+            numStarted++;
+           }
+       }
+
+    // check for no worker started, files are loaded here instead
+    if( numStarted == 0 )
+       {
+        loadRoomFileRuns( &fileQueue );
+       }
+
+    // wait for all files to be loaded
+    for( index = 0; index < numStarted; index++ )
+       {
+        pthread_join( threadArray[ index ], NULL );
+       }
+
+    free( threadArray );
+    pthread_mutex_destroy( &fileQueue.queueLock );
+
+    // merge sorted runs in file order
+    mergedPtrs = mergeRoomFileRuns( fileQueue.runArray, numFiles, 
+                                                                &mergedCount );
+
+    // empty tree is built directly from merged records, if any,
+    // so no arena is created for a tree that stays empty
+    if( isEmpty( *rootPtr ) && mergedCount > 0 )
+       {
+        *rootPtr = buildTreeFromSortedArray( createNodeArena(), mergedPtrs,
+                                                           0, mergedCount - 1 );
+       }
+
+    // otherwise, add records to existing tree
+    else
+       {
+        for( index = 0; index < mergedCount; index++ )
+           {
+            *rootPtr = insert( *rootPtr, mergedPtrs[ index ]->roomNumber,
+                                         mergedPtrs[ index ]->buildingRoom,
+                                         mergedPtrs[ index ]->classSetup,
+                                         mergedPtrs[ index ]->roomCapacity );
+           }
+       }
+
+    // release runs
+    for( index = 0; index < numFiles; index++ )
+       {
+        totalCount += fileQueue.runArray[ index ].numRecords;
+
+        free( fileQueue.runArray[ index ].orderedPtrs );
+        free( fileQueue.runArray[ index ].recordArray );
+       }
+
+    free( mergedPtrs );
+    free( fileQueue.runArray );
+
+    return totalCount;
+   }
+
+/*
+Name: loadRoomFileRuns
+Process: thread worker, repeatedly takes next file from queue,
+         reads its records and puts them in sorted, duplicate free order,
+         until no files remain
+Function input/parameters: file queue (void *, RoomFileQueueType *)
+Function output/parameters: file runs filled in (RoomFileQueueType *)
+Function output/returned: NULL
+Device input/file: data from HD
+Device output/monitor: none
+Dependencies: pthread_mutex_lock, pthread_mutex_unlock, 
+              readRoomRecordsFromFile, createSortedRecordPointers
+*/
+void *loadRoomFileRuns( void *queuePtr )
+   {
+    RoomFileQueueType *fileQueue = (RoomFileQueueType *)queuePtr;
+    RoomFileRunType *runPtr;
+    int fileIndex;
+
+    while( true )
+       {
+        // take next file from queue
+        pthread_mutex_lock( &fileQueue->queueLock );
+
+        fileIndex = fileQueue->nextFileIndex;
+        fileQueue->nextFileIndex++;
+
+        pthread_mutex_unlock( &fileQueue->queueLock );
+
+        // check for no files remaining
+        if( fileIndex >= fileQueue->numFiles )
+           {
+            return NULL;
+           }
+
+        runPtr = &fileQueue->runArray[ fileIndex ];
+
+        // read records, file not found counts as empty
+        runPtr->numRecords = readRoomRecordsFromFile( runPtr->fileName, 
+                                                &runPtr->recordArray, false );
+
+        if( runPtr->numRecords < 0 )
+           {
+            runPtr->numRecords = 0;
+            runPtr->recordArray = NULL;
+           }
+
+        // put records in order
+        runPtr->orderedPtrs = createSortedRecordPointers( runPtr->recordArray, 
+                                   runPtr->numRecords, &runPtr->numUnique );
+        runPtr->nextIndex = 0;
+       }
+   }
+
+/*
+Name: mergeRoomFileRuns
+Process: merges sorted file runs into one sorted array of record pointers,
+         on equal room numbers the run from the earlier file is taken
+         and later duplicates are dropped
+Function input/parameters: file runs (RoomFileRunType *), 
+                           number of runs (int)
+Function output/parameters: number of merged records (int *)
+Function output/returned: merged record pointers (RoomRecordType **),
+                          caller frees
+Device input/---: none
+Device output/---: none
+Dependencies: malloc, sizeof, compareRecordKeys
+*/
+RoomRecordType **mergeRoomFileRuns( RoomFileRunType *runArray, int numRuns,
+                                                         int *mergedCountPtr )
+   {
+    RoomRecordType **mergedPtrs, *headPtr;
+    int runIndex, minIndex, totalCount = 0, mergedCount = 0;
+
+    // find space needed for all runs
+    for( runIndex = 0; runIndex < numRuns; runIndex++ )
+       {
+        totalCount += runArray[ runIndex ].numUnique;
+       }
+
+    mergedPtrs = (RoomRecordType **)malloc( 
+                  findMax( totalCount, 1 ) * sizeof( RoomRecordType * ) );
+
+    while( true )
+       {
+        // find run with smallest head, earliest run wins ties
+        minIndex = -1;
+
+        for( runIndex = 0; runIndex < numRuns; runIndex++ )
+           {
+            if( runArray[ runIndex ].nextIndex < runArray[ runIndex ].numUnique
+                && ( minIndex < 0 || compareRecordKeys( 
+                 runArray[ runIndex ].orderedPtrs[ 
+                                              runArray[ runIndex ].nextIndex ],
+                 runArray[ minIndex ].orderedPtrs[ 
+                                   runArray[ minIndex ].nextIndex ] ) < 0 ) )
+               {
+                minIndex = runIndex;
+               }
+           }
+
+        // check for all runs used
+        if( minIndex < 0 )
+           {
+            *mergedCountPtr = mergedCount;
+
+            return mergedPtrs;
+           }
+
+        headPtr = runArray[ minIndex ].orderedPtrs[ 
+                                               runArray[ minIndex ].nextIndex ];
+        runArray[ minIndex ].nextIndex++;
+
+        // keep record unless already taken from an earlier file
+        if( mergedCount == 0 || compareRecordKeys( 
+                                mergedPtrs[ mergedCount - 1 ], headPtr ) != 0 )
+           {
+            mergedPtrs[ mergedCount ] = headPtr;
+            mergedCount++;
+           }
+       }
+   }
+
+/*
+Name: readRoomRecordsFromFile
+Process: reads all room records of a file into a new, growable
+         record array, sets ordering key of each, header line is skipped, 
+         logs each record at debug level if verbose flag is set
+Function input/parameters: file name (const char *), verbose flag (bool)
+Function output/parameters: record array (RoomRecordType **), caller frees
+Function output/returned: number of records found, 
+                          or -1 if file could not be opened (int)
+Device input/file: data from HD
+Device output/monitor: records logged if verbose
+Dependencies: malloc, sizeof, openMappedInputFile, skipCsvRecordInMappedFile,
+              checkForEndOfMappedFile, readCsvFieldFromMappedFile, 
+              readCsvIntegerFromMappedFile, createRoomKey, realloc, LOG_DEBUG, 
+              closeMappedInputFile
+*/
+int readRoomRecordsFromFile( const char *fileName, 
+                           RoomRecordType **recordArrayPtr, bool verbose )
+   {
+    MappedInputFileType mappedFile;
+    RoomRecordType *recordPtr;
+    int index = 0;
+    int recordCapacity = INITIAL_RECORD_CAPACITY;
+    RoomRecordType *recordArray;
+    bool endOfRecord;
+
+    if( !openMappedInputFile( &mappedFile, fileName ) )
+       {
+        // file not found
+        *recordArrayPtr = NULL;
+
+        return -1;
+       }
+
+    // to be ignored - header line
+    skipCsvRecordInMappedFile( &mappedFile );
+
+    recordArray = (RoomRecordType *)malloc( 
+                                   recordCapacity * sizeof( RoomRecordType ) );
+
+    while( !checkForEndOfMappedFile( &mappedFile ) )
+       {
+        // grow record buffer as needed
+        if( index == recordCapacity )
+           {
+            recordCapacity *= 2;
+
+            recordArray = (RoomRecordType *)realloc( recordArray, 
+                                   recordCapacity * sizeof( RoomRecordType ) );
+           }
+
+        // fields are captured directly into next record
+        recordPtr = &recordArray[ index ];
+
+        readCsvFieldFromMappedFile( &mappedFile, recordPtr->roomNumber, 
+                                            ROOM_NUM_CAPACITY, &endOfRecord );
+
+        // skip blank lines
+        if( endOfRecord && recordPtr->roomNumber[ 0 ] == NULL_CHAR )
+           {
+            continue;
+           }
+
+        readCsvFieldFromMappedFile( &mappedFile, recordPtr->buildingRoom, 
+                                       BUILDING_ROOM_CAPACITY, &endOfRecord );
+
+        readCsvFieldFromMappedFile( &mappedFile, recordPtr->classSetup, 
+                                               SETUP_CAPACITY, &endOfRecord );
+
+        recordPtr->roomCapacity = readCsvIntegerFromMappedFile( 
+                                                   &mappedFile, &endOfRecord );
+
+        recordPtr->roomKey = createRoomKey( recordPtr->roomNumber );
+
+        // ignore any extra fields
+        if( !endOfRecord )
+           {
+            skipCsvRecordInMappedFile( &mappedFile );
+           }
+
+        if( verbose )
+           {
+            LOG_DEBUG( "Room number: %s | Building/Classroom: %s | "
+                       "Classroom setup: %s | Room capacity: %d",
+                       recordPtr->roomNumber, recordPtr->buildingRoom,
+                       recordPtr->classSetup, recordPtr->roomCapacity );
+           }
+
+        index++;
+       }
+
+    closeMappedInputFile( &mappedFile );
+
+    *recordArrayPtr = recordArray;
+
+    return index;
+   }
+
+/*
+Name: writeDataToFile
+Process: writes all rooms of tree to file in room number order,
+         with same header line and fields as room data input files,
+         fields separated by given delimiter, COMMA for CSV or TAB_CHAR 
+         for TSV; output is buffered so file is written in large blocks
+Function input/parameters: file name (const char *), 
+                           root pointer (AvlTreeNodeType *),
+                           field delimiter (char)
+Function output/parameters: none
+Function output/returned: number of rooms written, 
+                          or -1 if file could not be written (int)
+Device input/file: none
+Device output/file: room data written to HD
+Dependencies: openBufferedWriter, writeRoomHeader, initializeTreeIterator,
+              getNextTreeNode, writeRoomLine, accessBuildingRoom, 
+              accessClassSetup, closeBufferedWriter
+*/
+int writeDataToFile( const char *fileName, AvlTreeNodeType *rootPtr,
+                                                              char delimiter )
+   {
+    BufferedOutputWriterType writer;
+    TreeIteratorType iterator;
+    AvlTreeNodeType *nodePtr;
+    int numWritten = 0;
+    bool success;
+
+    initializeBufferedWriter( &writer );
+
+    if( !openBufferedWriter( &writer, fileName ) )
+       {
+        // file could not be created
+        return -1;
+       }
+
+    success = writeRoomHeader( &writer, delimiter );
+
+    // one line per room, in order
+    initializeTreeIterator( &iterator, rootPtr );
+
+    while( success && ( nodePtr = getNextTreeNode( &iterator ) ) != NULL )
+       {
+        success = writeRoomLine( &writer, nodePtr->roomNumber, 
+                                 accessBuildingRoom( nodePtr ), 
+                                 accessClassSetup( nodePtr ),
+                                 nodePtr->roomCapacity, delimiter );
+
+        numWritten++;
+       }
+
+    // write out what is left, report any failure
+    if( !closeBufferedWriter( &writer ) || !success )
+       {
+        return -1;
+       }
+
+    return numWritten;
+   }
+
+/*
+Name: writeRecordsToFile
+Process: writes records to file in array order, duplicates included,
+         with same header line and fields as room data input files,
+         fields separated by given delimiter, COMMA for CSV or TAB_CHAR 
+         for TSV; output is buffered so file is written in large blocks
+Function input/parameters: file name (const char *), 
+                           records (const RoomRecordType *),
+                           number of records (int), field delimiter (char)
+Function output/parameters: none
+Function output/returned: number of records written, 
+                          or -1 if file could not be written (int)
+Device input/file: none
+Device output/file: room data written to HD
+Dependencies: openBufferedWriter, writeRoomHeader, writeRoomLine,
+              closeBufferedWriter
+*/
+int writeRecordsToFile( const char *fileName, 
+                        const RoomRecordType *recordArray, int numRecords,
+                                                              char delimiter )
+   {
+    BufferedOutputWriterType writer;
+    int index;
+    bool success;
+
+    initializeBufferedWriter( &writer );
+
+    if( !openBufferedWriter( &writer, fileName ) )
+       {
+        // file could not be created
+        return -1;
+       }
+
+    success = writeRoomHeader( &writer, delimiter );
+
+    // one line per record
+    for( index = 0; success && index < numRecords; index++ )
+       {
+        success = writeRoomLine( &writer, recordArray[ index ].roomNumber,
+                                 recordArray[ index ].buildingRoom,
+                                 recordArray[ index ].classSetup,
+                                 recordArray[ index ].roomCapacity, 
+                                                                  delimiter );
+       }
+
+    // write out what is left, report any failure
+    if( !closeBufferedWriter( &writer ) || !success )
+       {
+        return -1;
+       }
+
+    return numRecords;
+   }
+
+/*
+Name: writeRoomHeader
+Process: writes header line of room data files
+Function input/parameters: open writer (BufferedOutputWriterType *),
+                           field delimiter (char)
+Function output/parameters: updated writer (BufferedOutputWriterType *)
+Function output/returned: success of operation (bool)
+Device input/file: none
+Device output/file: header line written when writer is flushed
+Dependencies: writeCharacterToBufferedWriter, 
+              writeDelimitedFieldToBufferedWriter
+*/
+bool writeRoomHeader( BufferedOutputWriterType *writerPtr, char delimiter )
+   {
+    const char *headerNames[] = { "Room Number", "Description", 
+                                  "Classroom Setup", "Capacity" };
+    int index;
+    bool success = true;
+
+    for( index = 0; success && index < 4; index++ )
+       {
+        if( index > 0 )
+           {
+            success = writeCharacterToBufferedWriter( writerPtr, delimiter );
+           }
+
+        success = success && writeDelimitedFieldToBufferedWriter( writerPtr,
+                                              headerNames[ index ], delimiter );
+       }
+
+    return success 
+               && writeCharacterToBufferedWriter( writerPtr, NEWLINE_CHAR );
+   }
+
+/*
+Name: writeRoomLine
+Process: writes one room as a line of room data file, text fields
+         quoted where needed
+Function input/parameters: open writer (BufferedOutputWriterType *),
+                           room number, building/room and class setup
+                           (const char *), capacity (int),
+                           field delimiter (char)
+Function output/parameters: updated writer (BufferedOutputWriterType *)
+Function output/returned: success of operation (bool)
+Device input/file: none
+Device output/file: room line written when writer is flushed
+Dependencies: writeDelimitedFieldToBufferedWriter,
+              writeCharacterToBufferedWriter, writeIntegerToBufferedWriter
+*/
+bool writeRoomLine( BufferedOutputWriterType *writerPtr, 
+                    const char *roomNumber, const char *buildingRoom, 
+                    const char *classSetup, int roomCapacity, char delimiter )
+   {
+    return writeDelimitedFieldToBufferedWriter( writerPtr, 
+                                                     roomNumber, delimiter )
+           && writeCharacterToBufferedWriter( writerPtr, delimiter )
+           && writeDelimitedFieldToBufferedWriter( writerPtr, 
+                                                   buildingRoom, delimiter )
+           && writeCharacterToBufferedWriter( writerPtr, delimiter )
+           && writeDelimitedFieldToBufferedWriter( writerPtr, 
+                                                     classSetup, delimiter )
+           && writeCharacterToBufferedWriter( writerPtr, delimiter )
+           && writeIntegerToBufferedWriter( writerPtr, roomCapacity )
+           && writeCharacterToBufferedWriter( writerPtr, NEWLINE_CHAR );
+   }
@@ -0,0 +1,204 @@
+#ifndef ROOM_DATA_UTILITY_H
+#define ROOM_DATA_UTILITY_H
+
+// Header files
+#include <pthread.h>
+#include "File_Input_Utility.h"
+#include "AVL_Tree_Utility.h"
+#include "Logging_Utility.h"
+
+// Constants
+
+typedef enum { INITIAL_RECORD_CAPACITY = 64 } RecordCapacities;
+
+// Data Structures
+
+typedef struct RoomFileRunStruct
+   {
+    const char *fileName;
+
+    RoomRecordType *recordArray;
+
+    RoomRecordType **orderedPtrs;
+
+    int numRecords, numUnique, nextIndex;
+   } RoomFileRunType;
+
+typedef struct RoomFileQueueStruct
+   {
+    RoomFileRunType *runArray;
+
+    int numFiles, nextFileIndex;
+
+    pthread_mutex_t queueLock;
+   } RoomFileQueueType;
+
+// Prototypes
+
+/*
+Name: getDataFromFile
+Process: uploads data from file with unknown number of data sets,
+         records are buffered, then bulk loaded in linear time
+         if tree is empty, otherwise inserted one at a time,
+         records are listed at debug log level, inserts at trace level
+Function input/parameters: file name (char *)
+Function output/parameters: root pointer (TreeNodeType **)
+Function output/returned: number of values found (int)
+Device input/file: data from HD
+Device output/monitor: none
+Dependencies: LOG_ENABLED, LOG_DEBUG, LOG_TRACE, readRoomRecordsFromFile, 
+              buildTreeFromRecordArray, insert, free
+*/
+int getDataFromFile( const char *fileName, AvlTreeNodeType **rootPtr );
+
+/*
+Name: getDataFromFiles
+Process: uploads data from several files into one tree,
+         files are parsed and put in order on up to the given number
+         of threads, sorted runs are then merged in file order so a
+         room number found in more than one file keeps the record from
+         the earliest file, as loading the files one after another does;
+         empty tree is bulk loaded, otherwise records are inserted,
+         files not found are skipped; calling thread loads all files
+         if no thread starts
+Function input/parameters: file names (const char **), number of files (int),
+                           number of threads (int)
+Function output/parameters: root pointer (AvlTreeNodeType **)
+Function output/returned: number of values found in all files (int)
+Device input/file: data from HD
+Device output/monitor: none
+Dependencies: malloc, sizeof, pthread_mutex_init, pthread_create, 
+              loadRoomFileRuns, pthread_join, pthread_mutex_destroy,
+              mergeRoomFileRuns, buildTreeFromSortedArray, createNodeArena,
+              insert, free
+*/
+int getDataFromFiles( const char **fileNames, int numFiles, int numThreads,
+                                                    AvlTreeNodeType **rootPtr );
+
+/*
+Name: loadRoomFileRuns
+Process: thread worker, repeatedly takes next file from queue,
+         reads its records and puts them in sorted, duplicate free order,
+         until no files remain
+Function input/parameters: file queue (void *, RoomFileQueueType *)
+Function output/parameters: file runs filled in (RoomFileQueueType *)
+Function output/returned: NULL
+Device input/file: data from HD
+Device output/monitor: none
+Dependencies: pthread_mutex_lock, pthread_mutex_unlock, 
+              readRoomRecordsFromFile, createSortedRecordPointers
+*/
+void *loadRoomFileRuns( void *queuePtr );
+
+/*
+Name: mergeRoomFileRuns
+Process: merges sorted file runs into one sorted array of record pointers,
+         on equal room numbers the run from the earlier file is taken
+         and later duplicates are dropped
+Function input/parameters: file runs (RoomFileRunType *), 
+                           number of runs (int)
+Function output/parameters: number of merged records (int *)
+Function output/returned: merged record pointers (RoomRecordType **),
+                          caller frees
+Device input/---: none
+Device output/---: none
+Dependencies: malloc, sizeof, compareRecordKeys
+*/
+RoomRecordType **mergeRoomFileRuns( RoomFileRunType *runArray, int numRuns,
+                                                        int *mergedCountPtr );
+
+/*
+Name: readRoomRecordsFromFile
+Process: reads all room records of a file into a new, growable
+         record array, sets ordering key of each, header line is skipped, 
+         logs each record at debug level if verbose flag is set
+Function input/parameters: file name (const char *), verbose flag (bool)
+Function output/parameters: record array (RoomRecordType **), caller frees
+Function output/returned: number of records found, 
+                          or -1 if file could not be opened (int)
+Device input/file: data from HD
+Device output/monitor: records logged if verbose
+Dependencies: malloc, sizeof, openMappedInputFile, skipCsvRecordInMappedFile,
+              checkForEndOfMappedFile, readCsvFieldFromMappedFile, 
+              readCsvIntegerFromMappedFile, createRoomKey, realloc, LOG_DEBUG, 
+              closeMappedInputFile
+*/
+int readRoomRecordsFromFile( const char *fileName, 
+                          RoomRecordType **recordArrayPtr, bool verbose );
+
+/*
+Name: writeDataToFile
+Process: writes all rooms of tree to file in room number order,
+         with same header line and fields as room data input files,
+         fields separated by given delimiter, COMMA for CSV or TAB_CHAR 
+         for TSV; output is buffered so file is written in large blocks
+Function input/parameters: file name (const char *), 
+                           root pointer (AvlTreeNodeType *),
+                           field delimiter (char)
+Function output/parameters: none
+Function output/returned: number of rooms written, 
+                          or -1 if file could not be written (int)
+Device input/file: none
+Device output/file: room data written to HD
+Dependencies: openBufferedWriter, writeRoomHeader, initializeTreeIterator,
+              getNextTreeNode, writeRoomLine, accessBuildingRoom, 
+              accessClassSetup, closeBufferedWriter
+*/
+int writeDataToFile( const char *fileName, AvlTreeNodeType *rootPtr,
+                                                             char delimiter );
+
+/*
+Name: writeRecordsToFile
+Process: writes records to file in array order, duplicates included,
+         with same header line and fields as room data input files,
+         fields separated by given delimiter, COMMA for CSV or TAB_CHAR 
+         for TSV; output is buffered so file is written in large blocks
+Function input/parameters: file name (const char *), 
+                           records (const RoomRecordType *),
+                           number of records (int), field delimiter (char)
+Function output/parameters: none
+Function output/returned: number of records written, 
+                          or -1 if file could not be written (int)
+Device input/file: none
+Device output/file: room data written to HD
+Dependencies: openBufferedWriter, writeRoomHeader, writeRoomLine,
+              closeBufferedWriter
+*/
+int writeRecordsToFile( const char *fileName, 
+                        const RoomRecordType *recordArray, int numRecords,
+                                                              char delimiter );
+
+/*
+Name: writeRoomHeader
+Process: writes header line of room data files
+Function input/parameters: open writer (BufferedOutputWriterType *),
+                           field delimiter (char)
+Function output/parameters: updated writer (BufferedOutputWriterType *)
+Function output/returned: success of operation (bool)
+Device input/file: none
+Device output/file: header line written when writer is flushed
+Dependencies: writeCharacterToBufferedWriter, 
+              writeDelimitedFieldToBufferedWriter
+*/
+bool writeRoomHeader( BufferedOutputWriterType *writerPtr, char delimiter );
+
+/*
+Name: writeRoomLine
+Process: writes one room as a line of room data file, text fields
+         quoted where needed
+Function input/parameters: open writer (BufferedOutputWriterType *),
+                           room number, building/room and class setup
+                           (const char *), capacity (int),
+                           field delimiter (char)
+Function output/parameters: updated writer (BufferedOutputWriterType *)
+Function output/returned: success of operation (bool)
+Device input/file: none
+Device output/file: room line written when writer is flushed
+Dependencies: writeDelimitedFieldToBufferedWriter,
+              writeCharacterToBufferedWriter, writeIntegerToBufferedWriter
+*/
+bool writeRoomLine( BufferedOutputWriterType *writerPtr, 
+                    const char *roomNumber, const char *buildingRoom, 
+                    const char *classSetup, int roomCapacity, char delimiter );
+
+#endif   // ROOM_DATA_UTILITY_H
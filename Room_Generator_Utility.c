@@ -0,0 +1,318 @@
+// header files
+#include "Room_Generator_Utility.h"
+
+/*
+Name: createRoomRecords
+Process: creates given number of room records in given distribution:
+         forward and reverse are in room number order and reverse order,
+         random is shuffled, clustered keeps rooms of each building
+         together with buildings and their rooms in random order,
+         duplicate draws each row from a pool of one tenth as many
+         room numbers; same seed always gives same records
+Function input/parameters: number of rows (int), distribution (int),
+                           random seed, not zero (unsigned long long)
+Function output/parameters: none
+Function output/returned: new record array, caller frees, or NULL
+                          for row count or distribution out of range
+                          (RoomRecordType *)
+Device input/---: none
+Device output/---: none
+Dependencies: malloc, sizeof, findRoomsPerBuilding, fillRoomRecord,
+              shuffleRoomRecords, findNextRandomValue, free
+*/
+RoomRecordType *createRoomRecords( int numRows, int distribution,
+                                                  unsigned long long seed )
+   {
+    RoomRecordType *recordArray, *orderedArray;
+    int *buildingOrder;
+    unsigned long long randomState = seed;
+    int index, roomsPerBuilding, numBuildings, numPool;
+    int buildingIndex, swapIndex, swapValue, rowIndex, firstIndex, lastIndex;
+
+    if( numRows < 1 || numRows > MAX_GENERATED_ROWS
+                       || distribution < 0 || distribution >= NUM_DISTRIBUTIONS
+                                                               || seed == 0 )
+       {
+        return NULL;
+       }
+
+    recordArray = (RoomRecordType *)malloc(
+                                         numRows * sizeof( RoomRecordType ) );
+
+    // duplicate rows are drawn from a smaller pool of room numbers
+    if( distribution == DUPLICATE_DISTRIBUTION )
+       {
+        numPool = numRows / DUPLICATE_POOL_DIVISOR;
+
+        if( numPool < 1 )
+           {
+            numPool = 1;
+           }
+
+        roomsPerBuilding = findRoomsPerBuilding( numPool );
+
+        for( index = 0; index < numRows; index++ )
+           {
+            fillRoomRecord( &recordArray[ index ],
+                    (int)( findNextRandomValue( &randomState ) % numPool ),
+                                            roomsPerBuilding, &randomState );
+           }
+
+        return recordArray;
+       }
+
+    // all other orders hold each room once, made here in order
+    roomsPerBuilding = findRoomsPerBuilding( numRows );
+
+    for( index = 0; index < numRows; index++ )
+       {
+        if( distribution == REVERSE_DISTRIBUTION )
+           {
+            fillRoomRecord( &recordArray[ index ], numRows - 1 - index,
+                                            roomsPerBuilding, &randomState );
+           }
+
+        else
+           {
+            fillRoomRecord( &recordArray[ index ], index,
+                                            roomsPerBuilding, &randomState );
+           }
+       }
+
+    if( distribution == RANDOM_DISTRIBUTION )
+       {
+        shuffleRoomRecords( recordArray, numRows, &randomState );
+       }
+
+    else if( distribution == CLUSTERED_DISTRIBUTION )
+       {
+        numBuildings = ( numRows + roomsPerBuilding - 1 ) / roomsPerBuilding;
+        buildingOrder = (int *)malloc( numBuildings * sizeof( int ) );
+        orderedArray = (RoomRecordType *)malloc(
+                                         numRows * sizeof( RoomRecordType ) );
+
+        // shuffle order of buildings
+        for( index = 0; index < numBuildings; index++ )
+           {
+            buildingOrder[ index ] = index;
+           }
+
+        for( index = numBuildings - 1; index > 0; index-- )
+           {
+            swapIndex = (int)( findNextRandomValue( &randomState )
+                                                             % ( index + 1 ) );
+            swapValue = buildingOrder[ index ];
+            buildingOrder[ index ] = buildingOrder[ swapIndex ];
+            buildingOrder[ swapIndex ] = swapValue;
+           }
+
+        // copy each building's rooms in turn, then shuffle within it
+        rowIndex = 0;
+
+        for( index = 0; index < numBuildings; index++ )
+           {
+            buildingIndex = buildingOrder[ index ];
+            firstIndex = buildingIndex * roomsPerBuilding;
+            lastIndex = findMin( firstIndex + roomsPerBuilding, numRows );
+
+            shuffleRoomRecords( &recordArray[ firstIndex ],
+                                     lastIndex - firstIndex, &randomState );
+
+            while( firstIndex < lastIndex )
+               {
+                orderedArray[ rowIndex ] = recordArray[ firstIndex ];
+
+                rowIndex++;
+                firstIndex++;
+               }
+           }
+
+        free( buildingOrder );
+        free( recordArray );
+
+        recordArray = orderedArray;
+       }
+
+    return recordArray;
+   }
+
+/*
+Name: fillRoomRecord
+Process: sets room number and description from room index, building
+         is index divided by rooms per building, room is remainder
+         counted from MIN_GENERATED_ROOM; class setup and capacity
+         are random
+Function input/parameters: room index (int), rooms per building (int),
+                           random state (unsigned long long *)
+Function output/parameters: filled record (RoomRecordType *),
+                            updated random state (unsigned long long *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: snprintf, copyString, findNextRandomValue
+*/
+void fillRoomRecord( RoomRecordType *recordPtr, int roomIndex,
+                     int roomsPerBuilding, unsigned long long *statePtr )
+   {
+    const char *buildingNames[] = { "Liberal Arts Building",
+                                    "Biological Sciences Building",
+                                    "Health and Learning Center",
+                                    "Bury Hall", "Ashurst Hall",
+                                    "Engineering Building",
+                                    "Physical Sciences Building",
+                                    "Music Building" };
+    const char *setupNames[] = { "Traditional Classroom",
+                                 "Computer Stations", "Seminar Seating",
+                                 "Tiered Seating - Fixed", "Auditorium",
+                                 "Conference Style - Round",
+                                 "Conference Style - Square",
+                                 "Science Lab Workstations" };
+    int numBuildingNames = sizeof( buildingNames ) / sizeof( char * );
+    int numSetupNames = sizeof( setupNames ) / sizeof( char * );
+    unsigned int building = (unsigned int)( roomIndex / roomsPerBuilding )
+                                                   % NUM_GENERATED_BUILDINGS;
+    unsigned int room = (unsigned int)( MIN_GENERATED_ROOM
+                                    + roomIndex % roomsPerBuilding ) % 100000;
+
+    snprintf( recordPtr->roomNumber, ROOM_NUM_CAPACITY, "%03u-%u",
+                                                              building, room );
+
+    // description has a comma, so written files quote it as the
+    // bundled files do
+    snprintf( recordPtr->buildingRoom, BUILDING_ROOM_CAPACITY,
+                        "%s, Building %u, Room %u",
+                        buildingNames[ building % numBuildingNames ],
+                                                              building, room );
+
+    copyString( recordPtr->classSetup,
+            setupNames[ findNextRandomValue( statePtr ) % numSetupNames ] );
+
+    recordPtr->roomCapacity
+                         = 10 + (int)( findNextRandomValue( statePtr ) % 291 );
+
+    recordPtr->roomKey = NO_ROOM_KEY;
+   }
+
+/*
+Name: findDistributionByName
+Process: finds distribution with given name, as given by
+         findDistributionName
+Function input/parameters: name (const char *)
+Function output/parameters: none
+Function output/returned: distribution, or -1 if name not known (int)
+Device input/---: none
+Device output/---: none
+Dependencies: findDistributionName, compareRoomNumbers
+*/
+int findDistributionByName( const char *name )
+   {
+    int distribution;
+
+    for( distribution = 0; distribution < NUM_DISTRIBUTIONS; distribution++ )
+       {
+        if( compareRoomNumbers( name,
+                                findDistributionName( distribution ) ) == 0 )
+           {
+            return distribution;
+           }
+       }
+
+    return -1;
+   }
+
+/*
+Name: findDistributionName
+Process: finds short name of distribution
+Function input/parameters: distribution (int)
+Function output/parameters: none
+Function output/returned: name, or "unknown" (const char *)
+Device input/---: none
+Device output/---: none
+Dependencies: none
+*/
+const char *findDistributionName( int distribution )
+   {
+    static const char *distributionNames[] = { "forward", "reverse",
+                                               "random", "clustered",
+                                               "duplicate" };
+
+    if( distribution < 0 || distribution >= NUM_DISTRIBUTIONS )
+       {
+        return "unknown";
+       }
+
+    return distributionNames[ distribution ];
+   }
+
+/*
+Name: findNextRandomValue
+Process: xorshift random values, same sequence for same starting state
+Function input/parameters: random state, not zero (unsigned long long *)
+Function output/parameters: updated random state (unsigned long long *)
+Function output/returned: random value (unsigned long long)
+Device input/---: none
+Device output/---: none
+Dependencies: none
+*/
+unsigned long long findNextRandomValue( unsigned long long *statePtr )
+   {
+    *statePtr ^= *statePtr << 13;
+    *statePtr ^= *statePtr >> 7;
+    *statePtr ^= *statePtr << 17;
+
+    return *statePtr;
+   }
+
+/*
+Name: findRoomsPerBuilding
+Process: finds rooms given to each building so the rows fill at most
+         NUM_GENERATED_BUILDINGS buildings, at least
+         MIN_ROOMS_PER_BUILDING each
+Function input/parameters: number of distinct rooms (int)
+Function output/parameters: none
+Function output/returned: rooms per building (int)
+Device input/---: none
+Device output/---: none
+Dependencies: none
+*/
+int findRoomsPerBuilding( int numRooms )
+   {
+    int roomsPerBuilding = ( numRooms + NUM_GENERATED_BUILDINGS - 1 )
+                                                    / NUM_GENERATED_BUILDINGS;
+
+    if( roomsPerBuilding < MIN_ROOMS_PER_BUILDING )
+       {
+        roomsPerBuilding = MIN_ROOMS_PER_BUILDING;
+       }
+
+    return roomsPerBuilding;
+   }
+
+/*
+Name: shuffleRoomRecords
+Process: puts records in random order, Fisher-Yates shuffle
+Function input/parameters: records (RoomRecordType *),
+                           number of records (int),
+                           random state (unsigned long long *)
+Function output/parameters: shuffled records (RoomRecordType *),
+                            updated random state (unsigned long long *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: findNextRandomValue
+*/
+void shuffleRoomRecords( RoomRecordType *recordArray, int numRecords,
+                                            unsigned long long *statePtr )
+   {
+    RoomRecordType tempRecord;
+    int index, swapIndex;
+
+    for( index = numRecords - 1; index > 0; index-- )
+       {
+        swapIndex = (int)( findNextRandomValue( statePtr ) % ( index + 1 ) );
+
+        tempRecord = recordArray[ index ];
+        recordArray[ index ] = recordArray[ swapIndex ];
+        recordArray[ swapIndex ] = tempRecord;
+       }
+   }
@@ -0,0 +1,131 @@
+#ifndef ROOM_GENERATOR_UTILITY_H
+#define ROOM_GENERATOR_UTILITY_H
+
+// Header files
+#include "AVL_Tree_Utility.h"
+
+// Constants
+
+// row orders, forward and reverse match the F and B data files
+typedef enum { FORWARD_DISTRIBUTION, REVERSE_DISTRIBUTION,
+               RANDOM_DISTRIBUTION, CLUSTERED_DISTRIBUTION,
+               DUPLICATE_DISTRIBUTION, NUM_DISTRIBUTIONS } RoomDistributions;
+
+// room numbers are BBB-RRR up to BBB-RRRRR, one in DUPLICATE_POOL_DIVISOR
+// rows is distinct for duplicate distribution
+typedef enum { NUM_GENERATED_BUILDINGS = 1000, MIN_GENERATED_ROOM = 100,
+               MIN_ROOMS_PER_BUILDING = 20, DUPLICATE_POOL_DIVISOR = 10,
+               MAX_GENERATED_ROWS = 10000000 } GeneratorLimits;
+
+#define DEFAULT_GENERATOR_SEED 88172645463325252ULL
+
+// Prototypes
+
+/*
+Name: createRoomRecords
+Process: creates given number of room records in given distribution:
+         forward and reverse are in room number order and reverse order,
+         random is shuffled, clustered keeps rooms of each building
+         together with buildings and their rooms in random order,
+         duplicate draws each row from a pool of one tenth as many
+         room numbers; same seed always gives same records
+Function input/parameters: number of rows (int), distribution (int),
+                           random seed, not zero (unsigned long long)
+Function output/parameters: none
+Function output/returned: new record array, caller frees, or NULL
+                          for row count or distribution out of range
+                          (RoomRecordType *)
+Device input/---: none
+Device output/---: none
+Dependencies: malloc, sizeof, findRoomsPerBuilding, fillRoomRecord,
+              shuffleRoomRecords, findNextRandomValue, free
+*/
+RoomRecordType *createRoomRecords( int numRows, int distribution,
+                                                  unsigned long long seed );
+
+/*
+Name: fillRoomRecord
+Process: sets room number and description from room index, building
+         is index divided by rooms per building, room is remainder
+         counted from MIN_GENERATED_ROOM; class setup and capacity
+         are random
+Function input/parameters: room index (int), rooms per building (int),
+                           random state (unsigned long long *)
+Function output/parameters: filled record (RoomRecordType *),
+                            updated random state (unsigned long long *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: snprintf, copyString, findNextRandomValue
+*/
+void fillRoomRecord( RoomRecordType *recordPtr, int roomIndex,
+                     int roomsPerBuilding, unsigned long long *statePtr );
+
+/*
+Name: findDistributionByName
+Process: finds distribution with given name, as given by
+         findDistributionName
+Function input/parameters: name (const char *)
+Function output/parameters: none
+Function output/returned: distribution, or -1 if name not known (int)
+Device input/---: none
+Device output/---: none
+Dependencies: findDistributionName, compareRoomNumbers
+*/
+int findDistributionByName( const char *name );
+
+/*
+Name: findDistributionName
+Process: finds short name of distribution
+Function input/parameters: distribution (int)
+Function output/parameters: none
+Function output/returned: name, or "unknown" (const char *)
+Device input/---: none
+Device output/---: none
+Dependencies: none
+*/
+const char *findDistributionName( int distribution );
+
+/*
+Name: findNextRandomValue
+Process: xorshift random values, same sequence for same starting state
+Function input/parameters: random state, not zero (unsigned long long *)
+Function output/parameters: updated random state (unsigned long long *)
+Function output/returned: random value (unsigned long long)
+Device input/---: none
+Device output/---: none
+Dependencies: none
+*/
+unsigned long long findNextRandomValue( unsigned long long *statePtr );
+
+/*
+Name: findRoomsPerBuilding
+Process: finds rooms given to each building so the rows fill at most
+         NUM_GENERATED_BUILDINGS buildings, at least
+         MIN_ROOMS_PER_BUILDING each
+Function input/parameters: number of distinct rooms (int)
+Function output/parameters: none
+Function output/returned: rooms per building (int)
+Device input/---: none
+Device output/---: none
+Dependencies: none
+*/
+int findRoomsPerBuilding( int numRooms );
+
+/*
+Name: shuffleRoomRecords
+Process: puts records in random order, Fisher-Yates shuffle
+Function input/parameters: records (RoomRecordType *),
+                           number of records (int),
+                           random state (unsigned long long *)
+Function output/parameters: shuffled records (RoomRecordType *),
+                            updated random state (unsigned long long *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: findNextRandomValue
+*/
+void shuffleRoomRecords( RoomRecordType *recordArray, int numRecords,
+                                            unsigned long long *statePtr );
+
+#endif   // ROOM_GENERATOR_UTILITY_H
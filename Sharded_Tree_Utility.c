@@ -0,0 +1,426 @@
+// header files
+#include "Sharded_Tree_Utility.h"
+
+ShardedTreeType* clearShardedTree(ShardedTreeType* forestPtr)
+{
+    // initialize variables
+    int index;
+
+    // release tree and lock of each shard
+    for ( index = 0; index < forestPtr->numShards; index++ )
+    {
+        clearTree( forestPtr->shards[ index ].rootPtr );
+        pthread_mutex_destroy( &forestPtr->shards[ index ].shardLock );
+    }
+
+    // release shards and forest
+    free( forestPtr->shardBlockPtr );
+    free( forestPtr );
+
+    // return cleared forest ptr
+    return NULL;
+}
+
+void closeShardedIterator(ShardedTreeIteratorType* iteratorPtr)
+{
+    // initialize variables
+    int index;
+
+    // let writers in again
+    for ( index = 0; index < iteratorPtr->forestPtr->numShards; index++ )
+    {
+        pthread_mutex_unlock( &iteratorPtr->forestPtr->shards[ index ]
+                                                                  .shardLock );
+    }
+
+    free( iteratorPtr->shardIterators );
+    free( iteratorPtr->nextNodePtrs );
+    free( iteratorPtr->heapShards );
+}
+
+int countShardedTreeNodes(ShardedTreeType* forestPtr)
+{
+    // initialize variables
+    TreeShardType *shardPtr;
+    int numNodes = 0, index;
+
+    // add rooms of each shard
+    for ( index = 0; index < forestPtr->numShards; index++ )
+    {
+        shardPtr = &forestPtr->shards[ index ];
+
+        pthread_mutex_lock( &shardPtr->shardLock );
+        numNodes += countTreeNodes( shardPtr->rootPtr );
+        pthread_mutex_unlock( &shardPtr->shardLock );
+    }
+
+    // return number of rooms
+    return numNodes;
+}
+
+ShardedTreeType* createShardedTree(int numShards, ShardRouting routing)
+{
+    // initialize variables
+    ShardedTreeType *forestPtr;
+    size_t shardAddress;
+    int index;
+
+    // at least one shard
+    if ( numShards < 1 )
+    {
+        numShards = 1;
+    }
+
+    forestPtr = (ShardedTreeType *)malloc( sizeof(ShardedTreeType) );
+    forestPtr->numShards = numShards;
+    forestPtr->routing = routing;
+
+    // create shards on cache line boundary
+    forestPtr->shardBlockPtr = malloc( numShards * sizeof(TreeShardType)
+                                                          + SHARD_ALIGNMENT );
+    shardAddress = (size_t)forestPtr->shardBlockPtr + SHARD_ALIGNMENT - 1;
+    shardAddress -= shardAddress % SHARD_ALIGNMENT;
+    forestPtr->shards = (TreeShardType *)shardAddress;
+
+    // each shard starts empty with its own lock
+    for ( index = 0; index < numShards; index++ )
+    {
+        forestPtr->shards[ index ].rootPtr = initializeTree();
+        pthread_mutex_init( &forestPtr->shards[ index ].shardLock, NULL );
+    }
+
+    // return new forest
+    return forestPtr;
+}
+
+int findShardIndex(ShardedTreeType* forestPtr, const char* roomNumber)
+{
+    // initialize variables, FNV-1a offset basis
+    unsigned int hashVal = 2166136261u;
+    int index;
+
+    // check for routing by whole room number
+    if ( forestPtr->routing == SHARD_BY_ROOM_HASH )
+    {
+        return (int)( findStringHash( roomNumber )
+                                       % (unsigned int)forestPtr->numShards );
+    }
+
+    // mix in building characters, up to dash
+    for ( index = 0; roomNumber[ index ] != NULL_CHAR
+                                       && roomNumber[ index ] != DASH; index++ )
+    {
+        hashVal = ( hashVal ^ (unsigned char)roomNumber[ index ] ) * 16777619u;
+    }
+
+    // return shard of building
+    return (int)( hashVal % (unsigned int)forestPtr->numShards );
+}
+
+AvlTreeNodeType* getNextShardedNode(ShardedTreeIteratorType* iteratorPtr)
+{
+    // initialize variables
+    AvlTreeNodeType *nodePtr;
+    int shardIndex;
+
+    // check for every shard done
+    if ( iteratorPtr->heapSize == 0 )
+    {
+        return NULL;
+    }
+
+    // take earliest next node, from shard at top of heap
+    shardIndex = iteratorPtr->heapShards[ 0 ];
+    nodePtr = iteratorPtr->nextNodePtrs[ shardIndex ];
+
+    iteratorPtr->nextNodePtrs[ shardIndex ]
+           = getNextTreeNode( &iteratorPtr->shardIterators[ shardIndex ] );
+
+    // check for shard done, last shard in heap takes its place
+    if ( iteratorPtr->nextNodePtrs[ shardIndex ] == NULL )
+    {
+        iteratorPtr->heapSize--;
+        iteratorPtr->heapShards[ 0 ]
+                         = iteratorPtr->heapShards[ iteratorPtr->heapSize ];
+    }
+
+    // move top shard to its place by its new next node
+    siftShardHeapDown( iteratorPtr, 0 );
+
+    // return node
+    return nodePtr;
+}
+
+void initializeShardedIterator(ShardedTreeIteratorType* iteratorPtr,
+                                                  ShardedTreeType* forestPtr)
+{
+    // initialize variables
+    int numShards = forestPtr->numShards;
+    int index;
+
+    iteratorPtr->forestPtr = forestPtr;
+    iteratorPtr->shardIterators = (TreeIteratorType *)malloc(
+                                        numShards * sizeof(TreeIteratorType) );
+    iteratorPtr->nextNodePtrs = (AvlTreeNodeType **)malloc(
+                                       numShards * sizeof(AvlTreeNodeType *) );
+    iteratorPtr->heapShards = (int *)malloc( numShards * sizeof(int) );
+    iteratorPtr->heapSize = 0;
+
+    // hold every shard, always in index order so lockers never deadlock
+    for ( index = 0; index < numShards; index++ )
+    {
+        pthread_mutex_lock( &forestPtr->shards[ index ].shardLock );
+    }
+
+    // find first node of each shard, shards with nodes go in heap
+    for ( index = 0; index < numShards; index++ )
+    {
+        initializeTreeIterator( &iteratorPtr->shardIterators[ index ],
+                                          forestPtr->shards[ index ].rootPtr );
+        iteratorPtr->nextNodePtrs[ index ]
+                   = getNextTreeNode( &iteratorPtr->shardIterators[ index ] );
+
+        if ( iteratorPtr->nextNodePtrs[ index ] != NULL )
+        {
+            iteratorPtr->heapShards[ iteratorPtr->heapSize ] = index;
+            iteratorPtr->heapSize++;
+        }
+    }
+
+    // order heap, from last parent up to top
+    for ( index = iteratorPtr->heapSize / 2 - 1; index >= 0; index-- )
+    {
+        siftShardHeapDown( iteratorPtr, index );
+    }
+}
+
+void insertShardedRecords(ShardedTreeType* forestPtr,
+                 RoomRecordType* recordArray, int numRecords, int numThreads)
+{
+    // initialize variables
+    ShardedLoadQueueType loadQueue;
+    pthread_t *threadArray;
+    int *recordShards;
+    int numShards = forestPtr->numShards;
+    int numStarted = 0, index, shardIndex;
+
+    // find shard of each record once, and count records per shard
+    recordShards = (int *)malloc( numRecords * sizeof(int) );
+    loadQueue.shardStarts = (int *)malloc( ( numShards + 1 ) * sizeof(int) );
+
+    for ( index = 0; index <= numShards; index++ )
+    {
+        loadQueue.shardStarts[ index ] = 0;
+    }
+
+    for ( index = 0; index < numRecords; index++ )
+    {
+        recordShards[ index ] = findShardIndex( forestPtr,
+                                           recordArray[ index ].roomNumber );
+        loadQueue.shardStarts[ recordShards[ index ] + 1 ]++;
+    }
+
+    // turn counts into start of each shard's records
+    for ( index = 0; index < numShards; index++ )
+    {
+        loadQueue.shardStarts[ index + 1 ] += loadQueue.shardStarts[ index ];
+    }
+
+    // group record indices by shard, input order kept within each shard,
+    // start of each shard is moved on while placing, then moved back
+    loadQueue.recordIndices = (int *)malloc( numRecords * sizeof(int) );
+
+    for ( index = 0; index < numRecords; index++ )
+    {
+        shardIndex = recordShards[ index ];
+
+        loadQueue.recordIndices[ loadQueue.shardStarts[ shardIndex ] ] = index;
+        loadQueue.shardStarts[ shardIndex ]++;
+    }
+
+    for ( index = numShards; index > 0; index-- )
+    {
+        loadQueue.shardStarts[ index ] = loadQueue.shardStarts[ index - 1 ];
+    }
+
+    loadQueue.shardStarts[ 0 ] = 0;
+
+    free( recordShards );
+
+    // set up queue of shards
+    loadQueue.forestPtr = forestPtr;
+    loadQueue.recordArray = recordArray;
+    loadQueue.nextShardIndex = 0;
+    pthread_mutex_init( &loadQueue.queueLock, NULL );
+
+    // no more threads than shards, at least one
+    numThreads = findMax( 1, findMin( numThreads, numShards ) );
+
+    threadArray = (pthread_t *)malloc( numThreads * sizeof(pthread_t) );
+
+    // start workers
+    for ( index = 0; index < numThreads; index++ )
+    {
+        // check for worker started
+        if ( pthread_create( &threadArray[ numStarted ], NULL,
+                                       insertShardedTasks, &loadQueue ) == 0 )
+        {
+            numStarted++;
+        }
+    }
+
+    // check for no worker started, shards are loaded here instead
+    if ( numStarted == 0 )
+    {
+        insertShardedTasks( &loadQueue );
+    }
+
+    // wait for all shards to be loaded
+    for ( index = 0; index < numStarted; index++ )
+    {
+        pthread_join( threadArray[ index ], NULL );
+    }
+
+    free( threadArray );
+    pthread_mutex_destroy( &loadQueue.queueLock );
+    free( loadQueue.recordIndices );
+    free( loadQueue.shardStarts );
+}
+
+void* insertShardedTasks(void* queuePtr)
+{
+    // initialize variables
+    ShardedLoadQueueType *loadQueue = (ShardedLoadQueueType *)queuePtr;
+    TreeShardType *shardPtr;
+    RoomRecordType *recordPtr;
+    int shardIndex, index;
+
+    while ( true )
+    {
+        // take next shard from queue
+        pthread_mutex_lock( &loadQueue->queueLock );
+
+        shardIndex = loadQueue->nextShardIndex;
+        loadQueue->nextShardIndex++;
+
+        pthread_mutex_unlock( &loadQueue->queueLock );
+
+        // check for no shards remaining
+        if ( shardIndex >= loadQueue->forestPtr->numShards )
+        {
+            return NULL;
+        }
+
+        // insert records of shard, other writers of shard wait
+        shardPtr = &loadQueue->forestPtr->shards[ shardIndex ];
+
+        pthread_mutex_lock( &shardPtr->shardLock );
+
+        for ( index = loadQueue->shardStarts[ shardIndex ];
+                   index < loadQueue->shardStarts[ shardIndex + 1 ]; index++ )
+        {
+            recordPtr = &loadQueue->recordArray[
+                                           loadQueue->recordIndices[ index ] ];
+
+            shardPtr->rootPtr = insert( shardPtr->rootPtr,
+                              recordPtr->roomNumber, recordPtr->buildingRoom,
+                              recordPtr->classSetup, recordPtr->roomCapacity );
+        }
+
+        pthread_mutex_unlock( &shardPtr->shardLock );
+    }
+}
+
+void insertShardedTree(ShardedTreeType* forestPtr,
+    char* rmNmbr, char* bldgRm, char* clsSetup, int capacity)
+{
+    // initialize variables
+    TreeShardType *shardPtr
+                 = &forestPtr->shards[ findShardIndex( forestPtr, rmNmbr ) ];
+
+    // insert under shard's lock, other shards stay open
+    pthread_mutex_lock( &shardPtr->shardLock );
+
+    shardPtr->rootPtr = insert( shardPtr->rootPtr,
+                                       rmNmbr, bldgRm, clsSetup, capacity );
+
+    pthread_mutex_unlock( &shardPtr->shardLock );
+}
+
+bool isShardBefore(ShardedTreeIteratorType* iteratorPtr,
+                                              int oneShard, int otherShard)
+{
+    // initialize variables
+    AvlTreeNodeType *onePtr = iteratorPtr->nextNodePtrs[ oneShard ];
+    AvlTreeNodeType *otherPtr = iteratorPtr->nextNodePtrs[ otherShard ];
+
+    // return result of comparing next nodes
+    return compareRoomKeys( onePtr->roomKey, onePtr->roomNumber,
+                              otherPtr->roomKey, otherPtr->roomNumber ) < 0;
+}
+
+bool searchShardedTree(ShardedTreeType* forestPtr, const char* roomNumber,
+                                                    RoomRecordType* recordPtr)
+{
+    // initialize variables
+    TreeShardType *shardPtr
+             = &forestPtr->shards[ findShardIndex( forestPtr, roomNumber ) ];
+    AvlTreeNodeType *foundPtr;
+
+    // search under shard's lock, writers may be rotating it
+    pthread_mutex_lock( &shardPtr->shardLock );
+
+    foundPtr = search( shardPtr->rootPtr, roomNumber );
+
+    // check for room found
+    if ( foundPtr != NULL )
+    {
+        // copy data out before writers can move shard's string heap
+        copyString( recordPtr->roomNumber, foundPtr->roomNumber );
+        recordPtr->roomKey = foundPtr->roomKey;
+        copyStringWithLimit( recordPtr->buildingRoom,
+                       accessBuildingRoom( foundPtr ), BUILDING_ROOM_CAPACITY );
+        copyString( recordPtr->classSetup, accessClassSetup( foundPtr ) );
+        recordPtr->roomCapacity = foundPtr->roomCapacity;
+    }
+
+    pthread_mutex_unlock( &shardPtr->shardLock );
+
+    // return result of search
+    return foundPtr != NULL;
+}
+
+void siftShardHeapDown(ShardedTreeIteratorType* iteratorPtr, int position)
+{
+    // initialize variables
+    int *heapShards = iteratorPtr->heapShards;
+    int childPos, swapShard;
+
+    // loop while position has a child
+    while ( 2 * position + 1 < iteratorPtr->heapSize )
+    {
+        // find child with earlier next node
+        childPos = 2 * position + 1;
+
+        if ( childPos + 1 < iteratorPtr->heapSize
+              && isShardBefore( iteratorPtr, heapShards[ childPos + 1 ],
+                                                   heapShards[ childPos ] ) )
+        {
+            childPos++;
+        }
+
+        // check for shard already before both children
+        if ( !isShardBefore( iteratorPtr, heapShards[ childPos ],
+                                                   heapShards[ position ] ) )
+        {
+            return;
+        }
+
+        // swap shard with child, continue from child
+        swapShard = heapShards[ position ];
+        heapShards[ position ] = heapShards[ childPos ];
+        heapShards[ childPos ] = swapShard;
+
+        position = childPos;
+    }
+}
@@ -0,0 +1,283 @@
+#ifndef SHARDED_TREE_UTILITY_H
+#define SHARDED_TREE_UTILITY_H
+
+// Header files
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include "AVL_Tree_Utility.h"
+
+// Constants
+
+typedef enum { SHARD_ALIGNMENT = 64 } ShardLayout;
+
+// building routing keeps each building in one shard, room hash routing
+// spreads rooms evenly when there are few buildings
+typedef enum { SHARD_BY_BUILDING, SHARD_BY_ROOM_HASH } ShardRouting;
+
+// Data Structures
+
+// shard fields rounded up to whole cache lines, whatever the size of
+// the platform's mutex
+#define SHARD_STRIDE ( ( sizeof(pthread_mutex_t) \
+                           + sizeof(AvlTreeNodeType *) + SHARD_ALIGNMENT - 1 ) \
+                                          / SHARD_ALIGNMENT * SHARD_ALIGNMENT )
+
+// one independent tree and the lock its writers and readers take,
+// shards start on a cache line and fill whole lines each, so threads
+// working in different shards do not slow each other down
+typedef union TreeShardUnion
+   {
+    struct
+       {
+        pthread_mutex_t shardLock;
+
+        AvlTreeNodeType *rootPtr;
+       };
+
+    char padding[ SHARD_STRIDE ];
+   } TreeShardType;
+
+_Static_assert( sizeof(TreeShardType) % SHARD_ALIGNMENT == 0,
+                           "shard must fill whole cache lines" );
+
+// forest of trees, each room lives in the one shard its room number
+// routes to, so rooms are in order within each shard only
+typedef struct ShardedTreeStruct
+   {
+    TreeShardType *shards;
+
+    void *shardBlockPtr;
+
+    int numShards;
+
+    ShardRouting routing;
+   } ShardedTreeType;
+
+// records in shard order and next shard to load, shared by load threads
+typedef struct ShardedLoadQueueStruct
+   {
+    ShardedTreeType *forestPtr;
+
+    RoomRecordType *recordArray;
+
+    int *recordIndices, *shardStarts;
+
+    int nextShardIndex;
+
+    pthread_mutex_t queueLock;
+   } ShardedLoadQueueType;
+
+// in order iterator across shards: next node of each shard, and a
+// min heap of shards with nodes left ordered by that node
+typedef struct ShardedTreeIteratorStruct
+   {
+    ShardedTreeType *forestPtr;
+
+    TreeIteratorType *shardIterators;
+
+    AvlTreeNodeType **nextNodePtrs;
+
+    int *heapShards;
+
+    int heapSize;
+   } ShardedTreeIteratorType;
+
+// Prototypes
+
+/*
+Name: clearShardedTree
+Process: releases tree of every shard, shard locks, and forest itself,
+         no other thread may be using it
+Function input/parameters: forest (ShardedTreeType *)
+Function output/parameters: none
+Function output/returned: NULL
+Device input/---: none
+Device output/---: none
+Dependencies: clearTree, pthread_mutex_destroy, free
+*/
+ShardedTreeType *clearShardedTree( ShardedTreeType *forestPtr );
+
+/*
+Name: closeShardedIterator
+Process: lets writers change forest again and frees iterator arrays
+Function input/parameters: iterator (ShardedTreeIteratorType *)
+Function output/parameters: closed iterator (ShardedTreeIteratorType *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: pthread_mutex_unlock, free
+*/
+void closeShardedIterator( ShardedTreeIteratorType *iteratorPtr );
+
+/*
+Name: countShardedTreeNodes
+Process: counts rooms in all shards, each shard counted under its lock
+Function input/parameters: forest (ShardedTreeType *)
+Function output/parameters: none
+Function output/returned: number of rooms (int)
+Device input/---: none
+Device output/---: none
+Dependencies: pthread_mutex_lock, countTreeNodes, pthread_mutex_unlock
+*/
+int countShardedTreeNodes( ShardedTreeType *forestPtr );
+
+/*
+Name: createShardedTree
+Process: creates forest of given number of empty shards, at least one,
+         with given routing
+Function input/parameters: number of shards (int),
+                           routing (ShardRouting)
+Function output/parameters: none
+Function output/returned: new forest (ShardedTreeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: malloc, sizeof, initializeTree, pthread_mutex_init
+*/
+ShardedTreeType *createShardedTree( int numShards, ShardRouting routing );
+
+/*
+Name: findShardIndex
+Process: finds shard room number routes to: hash of building digits
+         before dash, or hash of whole room number, modulo shard count
+Function input/parameters: forest (ShardedTreeType *),
+                           room number (const char *)
+Function output/parameters: none
+Function output/returned: shard index (int)
+Device input/---: none
+Device output/---: none
+Dependencies: findStringHash
+*/
+int findShardIndex( ShardedTreeType *forestPtr, const char *roomNumber );
+
+/*
+Name: getNextShardedNode
+Process: returns next node in room number order across all shards,
+         taken from shard at top of heap, whose next node then
+         moves down heap to its place
+Function input/parameters: iterator (ShardedTreeIteratorType *)
+Function output/parameters: advanced iterator (ShardedTreeIteratorType *)
+Function output/returned: next node, or NULL when done (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: getNextTreeNode, siftShardHeapDown
+*/
+AvlTreeNodeType *getNextShardedNode( ShardedTreeIteratorType *iteratorPtr );
+
+/*
+Name: initializeShardedIterator
+Process: locks every shard in index order, so writers wait until
+         iterator is closed, then starts iterator of each shard and
+         builds heap of shards that have nodes
+Function input/parameters: iterator (ShardedTreeIteratorType *),
+                           forest (ShardedTreeType *)
+Function output/parameters: iterator at first node
+                            (ShardedTreeIteratorType *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: malloc, sizeof, pthread_mutex_lock, initializeTreeIterator,
+              getNextTreeNode, siftShardHeapDown
+*/
+void initializeShardedIterator( ShardedTreeIteratorType *iteratorPtr,
+                                                ShardedTreeType *forestPtr );
+
+/*
+Name: insertShardedRecords
+Process: inserts array of records using given number of threads: records
+         are grouped by shard first, then each thread takes whole shards
+         in turn, so no two threads insert into one shard at once;
+         calling thread loads all shards if no thread starts
+Function input/parameters: forest (ShardedTreeType *),
+                           records (RoomRecordType *),
+                           number of records, number of threads (int)
+Function output/parameters: forest with records added (ShardedTreeType *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: malloc, sizeof, findShardIndex, pthread_mutex_init,
+              insertShardedTasks, pthread_create, pthread_join,
+              pthread_mutex_destroy, free
+*/
+void insertShardedRecords( ShardedTreeType *forestPtr,
+               RoomRecordType *recordArray, int numRecords, int numThreads );
+
+/*
+Name: insertShardedTasks
+Process: thread function, takes next shard from load queue and inserts
+         all records of that shard under its lock, until no shard is left
+Function input/parameters: load queue (void *, ShardedLoadQueueType *)
+Function output/parameters: forest with shards loaded (ShardedTreeType *)
+Function output/returned: NULL (void *)
+Device input/---: none
+Device output/---: none
+Dependencies: pthread_mutex_lock, pthread_mutex_unlock, insert
+*/
+void *insertShardedTasks( void *queuePtr );
+
+/*
+Name: insertShardedTree
+Process: inserts room as insert does into the shard it routes to,
+         holding only that shard's lock
+Function input/parameters: forest (ShardedTreeType *),
+                           room number, building room data, class setup
+                           (char *), capacity (int)
+Function output/parameters: forest with room added (ShardedTreeType *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: findShardIndex, pthread_mutex_lock, insert,
+              pthread_mutex_unlock
+*/
+void insertShardedTree( ShardedTreeType *forestPtr,
+                     char *rmNmbr, char *bldgRm, char *clsSetup, int capacity );
+
+/*
+Name: isShardBefore
+Process: tests if next node of one shard orders before next node
+         of another
+Function input/parameters: iterator (ShardedTreeIteratorType *),
+                           two shard indices (int)
+Function output/parameters: none
+Function output/returned: Boolean result of test (bool)
+Device input/---: none
+Device output/---: none
+Dependencies: compareRoomKeys
+*/
+bool isShardBefore( ShardedTreeIteratorType *iteratorPtr,
+                                            int oneShard, int otherShard );
+
+/*
+Name: searchShardedTree
+Process: searches shard room number routes to and copies found room's
+         data out while holding that shard's lock, since writers to the
+         shard may move its nodes and string heap once it is released
+Function input/parameters: forest (ShardedTreeType *),
+                           room number (const char *)
+Function output/parameters: room data, when found (RoomRecordType *)
+Function output/returned: Boolean result of search (bool)
+Device input/---: none
+Device output/---: none
+Dependencies: findShardIndex, pthread_mutex_lock, search, copyString,
+              copyStringWithLimit, accessBuildingRoom, accessClassSetup,
+              pthread_mutex_unlock
+*/
+bool searchShardedTree( ShardedTreeType *forestPtr, const char *roomNumber,
+                                                  RoomRecordType *recordPtr );
+
+/*
+Name: siftShardHeapDown
+Process: moves shard at given heap position down until neither child
+         shard has an earlier next node
+Function input/parameters: iterator (ShardedTreeIteratorType *),
+                           heap position (int)
+Function output/parameters: iterator with heap in order
+                            (ShardedTreeIteratorType *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: isShardBefore
+*/
+void siftShardHeapDown( ShardedTreeIteratorType *iteratorPtr, int position );
+
+#endif   // SHARDED_TREE_UTILITY_H
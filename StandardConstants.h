@@ -40,15 +40,24 @@
 //Constant for a period
 #define PERIOD '.'
 
+//Constant for a plus sign
+#define PLUS '+'
+
 //Constant for PRECISION
 #define PRECISION 2
 
+//Constant for a double quote
+#define QUOTE '"'
+
 // constant for space character
 #define SPACE ' '
 
 // constant for standard string length
 #define STD_STR_LEN 64
 
+// constant for tab character
+#define TAB_CHAR '\t'
+
 #endif  // STANDARD_CONSTANTS
 
 
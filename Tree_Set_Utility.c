@@ -0,0 +1,496 @@
+// header files
+#include "Tree_Set_Utility.h"
+
+unsigned int appendSetStrings(NodeArenaType* destArenaPtr,
+                                              const NodeArenaType* srcArenaPtr)
+{
+    // initialize variables
+    unsigned int textBase = destArenaPtr->heapUsed, index;
+
+    // check for no text to add
+    if ( srcArenaPtr->heapUsed == 0 )
+    {
+        return textBase;
+    }
+
+    // grow heap until added text fits
+    if ( destArenaPtr->heapUsed + srcArenaPtr->heapUsed
+                                               > destArenaPtr->heapCapacity )
+    {
+        if ( destArenaPtr->heapCapacity == 0 )
+        {
+            destArenaPtr->heapCapacity = INITIAL_STRING_HEAP_CAPACITY;
+        }
+
+        while ( destArenaPtr->heapUsed + srcArenaPtr->heapUsed
+                                               > destArenaPtr->heapCapacity )
+        {
+            destArenaPtr->heapCapacity *= 2;
+        }
+
+        destArenaPtr->stringHeapPtr = (char *)realloc(
+                  destArenaPtr->stringHeapPtr, destArenaPtr->heapCapacity );
+    }
+
+    // copy text as is, so offsets only move by base
+    for ( index = 0; index < srcArenaPtr->heapUsed; index++ )
+    {
+        destArenaPtr->stringHeapPtr[ textBase + index ]
+                                       = srcArenaPtr->stringHeapPtr[ index ];
+    }
+
+    destArenaPtr->heapUsed += srcArenaPtr->heapUsed;
+
+    // return where added text starts
+    return textBase;
+}
+
+AvlTreeNodeType* combineTrees(TreeSetContextType* contextPtr,
+           AvlTreeNodeType* onePtr, AvlTreeNodeType* twoPtr, int numThreads)
+{
+    // initialize variables
+    AvlTreeNodeType *leftPtr, *rightPtr, *middlePtr;
+    TreeSetTaskType leftTask;
+    pthread_t leftThread;
+    bool isStarted;
+    SetOperation operation = contextPtr->operation;
+
+    // check for first tree used up
+    if ( isEmpty( onePtr ) )
+    {
+        // only union keeps rooms of second tree
+        if ( operation == SET_UNION )
+        {
+            return copySetSubtree( contextPtr, twoPtr );
+        }
+
+        return NULL;
+    }
+
+    // check for second tree used up
+    if ( isEmpty( twoPtr ) )
+    {
+        // intersection keeps nothing more
+        if ( operation == SET_INTERSECTION )
+        {
+            releaseSetSubtree( contextPtr, onePtr );
+
+            return NULL;
+        }
+
+        return onePtr;
+    }
+
+    // split first tree around room at root of second tree
+    middlePtr = splitTree( onePtr, twoPtr->roomKey, twoPtr->roomNumber,
+                                                        &leftPtr, &rightPtr );
+
+    // check for threads to spare and enough work to give one
+    if ( numThreads > 1
+              && findTreeHeight( twoPtr ) >= PARALLEL_SET_MIN_HEIGHT )
+    {
+        // combine left halves on new thread, with slabs of its own
+        leftTask.context = *contextPtr;
+        leftTask.context.slabArenaPtr = createNodeArena();
+        leftTask.onePtr = leftPtr;
+        leftTask.twoPtr = twoPtr->leftChildPtr;
+        leftTask.numThreads = numThreads / 2;
+
+        isStarted = pthread_create( &leftThread, NULL,
+                                               runSetTask, &leftTask ) == 0;
+
+        // combine right halves here, then wait for left
+        rightPtr = combineTrees( contextPtr, rightPtr, twoPtr->rightChildPtr,
+                                                numThreads - numThreads / 2 );
+
+        // check for thread started
+        if ( isStarted )
+        {
+            pthread_join( leftThread, NULL );
+        }
+        // otherwise, combine left halves here as well
+        else
+        {
+            runSetTask( &leftTask );
+        }
+
+        // hand new thread's nodes to this thread's slabs
+        mergeNodeArenas( contextPtr->slabArenaPtr,
+                                              leftTask.context.slabArenaPtr );
+        leftPtr = leftTask.resultPtr;
+    }
+    // otherwise, combine both halves on this thread
+    else
+    {
+        leftPtr = combineTrees( contextPtr, leftPtr, twoPtr->leftChildPtr,
+                                                                 numThreads );
+        rightPtr = combineTrees( contextPtr, rightPtr, twoPtr->rightChildPtr,
+                                                                 numThreads );
+    }
+
+    // check for union, root of second tree is kept with its data
+    if ( operation == SET_UNION )
+    {
+        // check for room also in first tree
+        if ( middlePtr != NULL )
+        {
+            // keep node, take data of second tree
+            middlePtr->roomCapacity = twoPtr->roomCapacity;
+            middlePtr->classSetupId = twoPtr->classSetupId;
+            middlePtr->buildingRoomOffset
+                           = twoPtr->buildingRoomOffset + contextPtr->textBase;
+            middlePtr->buildingRoomLength = twoPtr->buildingRoomLength;
+        }
+        else
+        {
+            middlePtr = copySetNode( contextPtr, twoPtr );
+        }
+
+        return joinTrees( leftPtr, middlePtr, rightPtr );
+    }
+
+    // check for intersection with room in both trees
+    if ( operation == SET_INTERSECTION && middlePtr != NULL )
+    {
+        return joinTrees( leftPtr, middlePtr, rightPtr );
+    }
+
+    // otherwise, room is dropped from result if it was found
+    releaseSetSubtree( contextPtr, middlePtr );
+
+    // return halves joined
+    return joinTreePair( leftPtr, rightPtr );
+}
+
+AvlTreeNodeType* copySetNode(TreeSetContextType* contextPtr,
+                                             const AvlTreeNodeType* sourcePtr)
+{
+    // initialize variables
+    AvlTreeNodeType *newNode = allocateArenaNode( contextPtr->slabArenaPtr );
+
+    // copy room data, node belongs to result arena
+    *newNode = *sourcePtr;
+    newNode->refCount = 1;
+    newNode->arenaPtr = contextPtr->arenaPtr;
+    newNode->buildingRoomOffset += contextPtr->textBase;
+
+    // new node is a leaf
+    newNode->height = 0;
+    newNode->leftChildPtr = NULL;
+    newNode->rightChildPtr = NULL;
+
+    // return new node
+    return newNode;
+}
+
+AvlTreeNodeType* copySetSubtree(TreeSetContextType* contextPtr,
+                                                   AvlTreeNodeType* sourcePtr)
+{
+    // initialize variables
+    AvlTreeNodeType *newNode;
+
+    // check for empty subtree
+    if ( isEmpty( sourcePtr ) )
+    {
+        return NULL;
+    }
+
+    // check for subtree in result arena
+    if ( sourcePtr->arenaPtr == contextPtr->arenaPtr )
+    {
+        // share it, nodes are copied only when changed
+        sourcePtr->refCount++;
+
+        return sourcePtr;
+    }
+
+    // copy node, then its subtrees, shape and heights stay the same
+    newNode = copySetNode( contextPtr, sourcePtr );
+    newNode->height = sourcePtr->height;
+    newNode->leftChildPtr = copySetSubtree( contextPtr,
+                                                    sourcePtr->leftChildPtr );
+    newNode->rightChildPtr = copySetSubtree( contextPtr,
+                                                   sourcePtr->rightChildPtr );
+
+    // return copied subtree
+    return newNode;
+}
+
+AvlTreeNodeType* joinLeftSpine(AvlTreeNodeType* leftPtr,
+                          AvlTreeNodeType* middlePtr, AvlTreeNodeType* rightPtr)
+{
+    // check for right subtree short enough to sit beside left tree
+    if ( findTreeHeight( rightPtr ) <= findTreeHeight( leftPtr ) + 1 )
+    {
+        // link both under middle node
+        middlePtr->leftChildPtr = leftPtr;
+        middlePtr->rightChildPtr = rightPtr;
+        updateNodeHeight( middlePtr );
+
+        return middlePtr;
+    }
+
+    // node is changed, copy it first if shared
+    rightPtr = unshareNode( rightPtr );
+
+    // call left recursion down left spine, assign to left child pointer
+    rightPtr->leftChildPtr = joinLeftSpine( leftPtr, middlePtr,
+                                                     rightPtr->leftChildPtr );
+
+    // return subtree balanced on the way back up
+    return rebalanceNode( rightPtr );
+}
+
+AvlTreeNodeType* joinRightSpine(AvlTreeNodeType* leftPtr,
+                          AvlTreeNodeType* middlePtr, AvlTreeNodeType* rightPtr)
+{
+    // check for left subtree short enough to sit beside right tree
+    if ( findTreeHeight( leftPtr ) <= findTreeHeight( rightPtr ) + 1 )
+    {
+        // link both under middle node
+        middlePtr->leftChildPtr = leftPtr;
+        middlePtr->rightChildPtr = rightPtr;
+        updateNodeHeight( middlePtr );
+
+        return middlePtr;
+    }
+
+    // node is changed, copy it first if shared
+    leftPtr = unshareNode( leftPtr );
+
+    // call right recursion down right spine, assign to right child pointer
+    leftPtr->rightChildPtr = joinRightSpine( leftPtr->rightChildPtr,
+                                                         middlePtr, rightPtr );
+
+    // return subtree balanced on the way back up
+    return rebalanceNode( leftPtr );
+}
+
+AvlTreeNodeType* joinTreePair(AvlTreeNodeType* leftPtr,
+                                                    AvlTreeNodeType* rightPtr)
+{
+    // initialize variables
+    AvlTreeNodeType *middlePtr;
+
+    // check for either tree empty
+    if ( isEmpty( leftPtr ) )
+    {
+        return rightPtr;
+    }
+
+    if ( isEmpty( rightPtr ) )
+    {
+        return leftPtr;
+    }
+
+    // smallest room of right tree joins the two
+    rightPtr = detachMinNode( rightPtr, &middlePtr );
+
+    // return joined tree
+    return joinTrees( leftPtr, middlePtr, rightPtr );
+}
+
+AvlTreeNodeType* joinTrees(AvlTreeNodeType* leftPtr,
+                          AvlTreeNodeType* middlePtr, AvlTreeNodeType* rightPtr)
+{
+    // initialize variables
+    int leftHeight = findTreeHeight( leftPtr );
+    int rightHeight = findTreeHeight( rightPtr );
+
+    // check for left tree too tall to be a sibling
+    if ( leftHeight > rightHeight + 1 )
+    {
+        return joinRightSpine( leftPtr, middlePtr, rightPtr );
+    }
+
+    // check for right tree too tall to be a sibling
+    if ( rightHeight > leftHeight + 1 )
+    {
+        return joinLeftSpine( leftPtr, middlePtr, rightPtr );
+    }
+
+    // otherwise, link both under middle node
+    middlePtr->leftChildPtr = leftPtr;
+    middlePtr->rightChildPtr = rightPtr;
+    updateNodeHeight( middlePtr );
+
+    // return joined tree
+    return middlePtr;
+}
+
+void releaseSetSubtree(TreeSetContextType* contextPtr,
+                                                     AvlTreeNodeType* wkgPtr)
+{
+    // check for empty subtree
+    if ( isEmpty( wkgPtr ) )
+    {
+        return;
+    }
+
+    // drop one link to node
+    wkgPtr->refCount--;
+
+    // check for no tree linking to node any longer
+    if ( wkgPtr->refCount == 0 )
+    {
+        // drop its links to children
+        releaseSetSubtree( contextPtr, wkgPtr->leftChildPtr );
+        releaseSetSubtree( contextPtr, wkgPtr->rightChildPtr );
+
+        // link node to front of free list of this thread's slabs
+        wkgPtr->leftChildPtr = contextPtr->slabArenaPtr->freeListPtr;
+        contextPtr->slabArenaPtr->freeListPtr = wkgPtr;
+    }
+}
+
+AvlTreeNodeType* runSetOperation(AvlTreeNodeType* onePtr,
+            AvlTreeNodeType* twoPtr, SetOperation operation, int numThreads)
+{
+    // initialize variables
+    TreeSetContextType context;
+    AvlTreeNodeType *resultPtr;
+
+    // check for empty first tree
+    if ( isEmpty( onePtr ) )
+    {
+        // union is second tree, shared until either one changes
+        if ( operation == SET_UNION )
+        {
+            return copyTree( twoPtr );
+        }
+
+        return NULL;
+    }
+
+    // result keeps first tree's arena, main thread uses it for slabs
+    context.arenaPtr = onePtr->arenaPtr;
+    context.slabArenaPtr = context.arenaPtr;
+    context.textBase = 0;
+    context.operation = operation;
+
+    // check for union copying nodes from another arena
+    if ( operation == SET_UNION && !isEmpty( twoPtr )
+                                    && twoPtr->arenaPtr != context.arenaPtr )
+    {
+        context.textBase = appendSetStrings( context.arenaPtr,
+                                                          twoPtr->arenaPtr );
+    }
+
+    // check for shared first tree, only this thread may copy its nodes
+    if ( context.arenaPtr->numVersions > 1 )
+    {
+        numThreads = 1;
+    }
+
+    resultPtr = combineTrees( &context, onePtr, twoPtr, numThreads );
+
+    // check for every room dropped
+    if ( isEmpty( resultPtr ) )
+    {
+        // check for last tree using arena
+        if ( context.arenaPtr->numVersions == 1 )
+        {
+            // release arena of now empty tree
+            clearNodeArena( context.arenaPtr );
+        }
+        // otherwise, copies still use arena
+        else
+        {
+            context.arenaPtr->numVersions--;
+        }
+    }
+
+    // return root of result
+    return resultPtr;
+}
+
+void* runSetTask(void* taskPtr)
+{
+    // initialize variables
+    TreeSetTaskType *setTask = (TreeSetTaskType *)taskPtr;
+
+    // combine halves given to this thread
+    setTask->resultPtr = combineTrees( &setTask->context, setTask->onePtr,
+                                        setTask->twoPtr, setTask->numThreads );
+
+    return NULL;
+}
+
+AvlTreeNodeType* splitTree(AvlTreeNodeType* wkgPtr,
+                      unsigned long long roomKey, const char* roomNumber,
+               AvlTreeNodeType** leftPtrPtr, AvlTreeNodeType** rightPtrPtr)
+{
+    // initialize variables
+    AvlTreeNodeType *middlePtr, *innerPtr;
+    int comparisonVal;
+
+    // check for empty tree, nothing on either side
+    if ( isEmpty( wkgPtr ) )
+    {
+        *leftPtrPtr = NULL;
+        *rightPtrPtr = NULL;
+
+        return NULL;
+    }
+
+    // node is changed either way, copy it first if shared
+    wkgPtr = unshareNode( wkgPtr );
+
+    // find comparison value
+    comparisonVal = compareRoomKeys( roomKey, roomNumber,
+                                       wkgPtr->roomKey, wkgPtr->roomNumber );
+
+    // check for room before current node
+    if ( comparisonVal < 0 )
+    {
+        // split left subtree, what is after room joins node's right side
+        middlePtr = splitTree( wkgPtr->leftChildPtr, roomKey, roomNumber,
+                                                     leftPtrPtr, &innerPtr );
+        *rightPtrPtr = joinTrees( innerPtr, wkgPtr, wkgPtr->rightChildPtr );
+
+        return middlePtr;
+    }
+
+    // check for room after current node
+    if ( comparisonVal > 0 )
+    {
+        // split right subtree, what is before room joins node's left side
+        middlePtr = splitTree( wkgPtr->rightChildPtr, roomKey, roomNumber,
+                                                    &innerPtr, rightPtrPtr );
+        *leftPtrPtr = joinTrees( wkgPtr->leftChildPtr, wkgPtr, innerPtr );
+
+        return middlePtr;
+    }
+
+    // otherwise, room found, its subtrees are the two sides
+    *leftPtrPtr = wkgPtr->leftChildPtr;
+    *rightPtrPtr = wkgPtr->rightChildPtr;
+
+    wkgPtr->leftChildPtr = NULL;
+    wkgPtr->rightChildPtr = NULL;
+    wkgPtr->height = 0;
+
+    // return node alone
+    return wkgPtr;
+}
+
+AvlTreeNodeType* treeDifference(AvlTreeNodeType* onePtr,
+                                        AvlTreeNodeType* twoPtr, int numThreads)
+{
+    // return first tree without rooms of second
+    return runSetOperation( onePtr, twoPtr, SET_DIFFERENCE, numThreads );
+}
+
+AvlTreeNodeType* treeIntersection(AvlTreeNodeType* onePtr,
+                                        AvlTreeNodeType* twoPtr, int numThreads)
+{
+    // return rooms of first tree also in second
+    return runSetOperation( onePtr, twoPtr, SET_INTERSECTION, numThreads );
+}
+
+AvlTreeNodeType* treeUnion(AvlTreeNodeType* onePtr,
+                                        AvlTreeNodeType* twoPtr, int numThreads)
+{
+    // return first tree with rooms of second added
+    return runSetOperation( onePtr, twoPtr, SET_UNION, numThreads );
+}
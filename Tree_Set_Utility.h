@@ -0,0 +1,307 @@
+#ifndef TREE_SET_UTILITY_H
+#define TREE_SET_UTILITY_H
+
+// Header files
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include "AVL_Tree_Utility.h"
+
+// Constants
+
+// halves are given to another thread only while the second tree's
+// subtree has at least about a thousand rooms
+typedef enum { PARALLEL_SET_MIN_HEIGHT = 12 } TreeSetLimits;
+
+typedef enum { SET_UNION, SET_INTERSECTION, SET_DIFFERENCE } SetOperation;
+
+// Data Structures
+
+// what one thread of a set operation works with: arena of result,
+// arena new and released nodes go to (result arena, or one of the
+// thread's own whose slabs are handed to result arena at the end),
+// and where second tree's text starts in result arena string heap
+typedef struct TreeSetContextStruct
+   {
+    NodeArenaType *arenaPtr, *slabArenaPtr;
+
+    unsigned int textBase;
+
+    SetOperation operation;
+   } TreeSetContextType;
+
+// one half of a set operation run on another thread
+typedef struct TreeSetTaskStruct
+   {
+    TreeSetContextType context;
+
+    AvlTreeNodeType *onePtr, *twoPtr, *resultPtr;
+
+    int numThreads;
+   } TreeSetTaskType;
+
+// Prototypes
+
+/*
+Name: appendSetStrings
+Process: adds text of second tree's arena to end of result arena's
+         string heap, so nodes copied from second tree find their text
+         at its old offset plus the returned base
+Function input/parameters: result arena (NodeArenaType *),
+                           second tree's arena (const NodeArenaType *)
+Function output/parameters: result arena with text added (NodeArenaType *)
+Function output/returned: offset of added text in result heap
+                          (unsigned int)
+Device input/---: none
+Device output/---: none
+Dependencies: realloc
+*/
+unsigned int appendSetStrings( NodeArenaType *destArenaPtr,
+                                         const NodeArenaType *srcArenaPtr );
+
+/*
+Name: combineTrees
+Process: recursively applies set operation of context: splits first
+         tree by root of second, combines left halves and right halves,
+         then joins results around second tree's root, first tree's
+         matching node, or neither, as the operation keeps it; with
+         more than one thread and a large enough second subtree, left
+         halves are combined on a new thread while this one does right,
+         or on this one after right when the thread does not start
+Function input/parameters: context (TreeSetContextType *),
+                           first tree, which is changed (AvlTreeNodeType *),
+                           second tree, read only (AvlTreeNodeType *),
+                           threads it may use (int)
+Function output/parameters: context arena with nodes added or released
+                            (TreeSetContextType *)
+Function output/returned: root of combined tree (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: isEmpty, copySetSubtree, releaseSetSubtree, splitTree,
+              findTreeHeight, createNodeArena, pthread_create,
+              runSetTask, combineTrees (recursively), pthread_join,
+              mergeNodeArenas, copySetNode, joinTrees, joinTreePair
+*/
+AvlTreeNodeType *combineTrees( TreeSetContextType *contextPtr,
+         AvlTreeNodeType *onePtr, AvlTreeNodeType *twoPtr, int numThreads );
+
+/*
+Name: copySetNode
+Process: copies node of second tree into result as a leaf, node is taken
+         from context's slab arena, its text is found past text base
+Function input/parameters: context (TreeSetContextType *),
+                           node of second tree (const AvlTreeNodeType *)
+Function output/parameters: none
+Function output/returned: new node (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: allocateArenaNode
+*/
+AvlTreeNodeType *copySetNode( TreeSetContextType *contextPtr,
+                                           const AvlTreeNodeType *sourcePtr );
+
+/*
+Name: copySetSubtree
+Process: gives result a subtree of second tree: shared as copyTree does
+         when second tree is in result arena, otherwise copied node for
+         node with shape and heights kept
+Function input/parameters: context (TreeSetContextType *),
+                           subtree of second tree (AvlTreeNodeType *)
+Function output/parameters: none
+Function output/returned: subtree root in result (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: isEmpty, copySetNode, copySetSubtree (recursively)
+*/
+AvlTreeNodeType *copySetSubtree( TreeSetContextType *contextPtr,
+                                                 AvlTreeNodeType *sourcePtr );
+
+/*
+Name: joinLeftSpine
+Process: joins trees around middle node when right tree is more than
+         one taller: goes down left spine of right tree to a subtree
+         about as tall as left tree, links there, rebalances going up
+Function input/parameters: left tree, middle node, right tree
+                           (AvlTreeNodeType *)
+Function output/parameters: none
+Function output/returned: root of joined tree (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: findTreeHeight, updateNodeHeight, unshareNode,
+              joinLeftSpine (recursively), rebalanceNode
+*/
+AvlTreeNodeType *joinLeftSpine( AvlTreeNodeType *leftPtr,
+                        AvlTreeNodeType *middlePtr, AvlTreeNodeType *rightPtr );
+
+/*
+Name: joinRightSpine
+Process: joins trees around middle node when left tree is more than
+         one taller: goes down right spine of left tree to a subtree
+         about as tall as right tree, links there, rebalances going up
+Function input/parameters: left tree, middle node, right tree
+                           (AvlTreeNodeType *)
+Function output/parameters: none
+Function output/returned: root of joined tree (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: findTreeHeight, updateNodeHeight, unshareNode,
+              joinRightSpine (recursively), rebalanceNode
+*/
+AvlTreeNodeType *joinRightSpine( AvlTreeNodeType *leftPtr,
+                        AvlTreeNodeType *middlePtr, AvlTreeNodeType *rightPtr );
+
+/*
+Name: joinTreePair
+Process: joins two trees, every room of left before every room of right,
+         with smallest node of right as middle node
+Function input/parameters: left tree, right tree (AvlTreeNodeType *)
+Function output/parameters: none
+Function output/returned: root of joined tree (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: isEmpty, detachMinNode, joinTrees
+*/
+AvlTreeNodeType *joinTreePair( AvlTreeNodeType *leftPtr,
+                                                  AvlTreeNodeType *rightPtr );
+
+/*
+Name: joinTrees
+Process: joins left tree, middle node and right tree, which are in order,
+         into one AVL tree in time proportional to their height difference
+Function input/parameters: left tree, middle node not in any tree,
+                           right tree (AvlTreeNodeType *)
+Function output/parameters: none
+Function output/returned: root of joined tree (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: findTreeHeight, joinRightSpine, joinLeftSpine,
+              updateNodeHeight
+*/
+AvlTreeNodeType *joinTrees( AvlTreeNodeType *leftPtr,
+                        AvlTreeNodeType *middlePtr, AvlTreeNodeType *rightPtr );
+
+/*
+Name: releaseSetSubtree
+Process: drops subtree from result: nodes no other tree links to go to
+         free list of context's slab arena
+Function input/parameters: context (TreeSetContextType *),
+                           subtree (AvlTreeNodeType *)
+Function output/parameters: context arena with nodes released
+                            (TreeSetContextType *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: isEmpty, releaseSetSubtree (recursively)
+*/
+void releaseSetSubtree( TreeSetContextType *contextPtr,
+                                                   AvlTreeNodeType *wkgPtr );
+
+/*
+Name: runSetOperation
+Process: sets up context for set operation, text of second tree is added
+         to result arena only when union may copy nodes from another
+         arena; shared first tree is combined on one thread, as copying
+         its shared nodes takes nodes from its arena; result left empty
+         gives up its arena as removeNode does
+Function input/parameters: first tree, which is changed (AvlTreeNodeType *),
+                           second tree, read only (AvlTreeNodeType *),
+                           operation (SetOperation), threads (int)
+Function output/parameters: none
+Function output/returned: root of result (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: isEmpty, copyTree, appendSetStrings, combineTrees,
+              clearNodeArena
+*/
+AvlTreeNodeType *runSetOperation( AvlTreeNodeType *onePtr,
+          AvlTreeNodeType *twoPtr, SetOperation operation, int numThreads );
+
+/*
+Name: runSetTask
+Process: thread function, combines halves of one set task
+Function input/parameters: task (void *, TreeSetTaskType *)
+Function output/parameters: task with result root (TreeSetTaskType *)
+Function output/returned: NULL (void *)
+Device input/---: none
+Device output/---: none
+Dependencies: combineTrees
+*/
+void *runSetTask( void *taskPtr );
+
+/*
+Name: splitTree
+Process: splits tree by room key into rooms before it and rooms after it,
+         joining subtrees on the way back up; node holding room, if any,
+         is handed back alone
+Function input/parameters: tree, which is changed (AvlTreeNodeType *),
+                           ordering key (unsigned long long),
+                           room number (const char *)
+Function output/parameters: left and right trees (AvlTreeNodeType **)
+Function output/returned: node with room, or NULL (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: isEmpty, unshareNode, compareRoomKeys,
+              splitTree (recursively), joinTrees
+*/
+AvlTreeNodeType *splitTree( AvlTreeNodeType *wkgPtr,
+                            unsigned long long roomKey, const char *roomNumber,
+             AvlTreeNodeType **leftPtrPtr, AvlTreeNodeType **rightPtrPtr );
+
+/*
+Name: treeDifference
+Process: removes from first tree every room in second tree,
+         in O(m log(n/m + 1)) for trees of m and n rooms, m <= n
+Function input/parameters: first tree, which is changed (AvlTreeNodeType *),
+                           second tree, read only and not first tree
+                           itself, a copyTree copy is fine
+                           (AvlTreeNodeType *),
+                           threads, 1 for this one only (int)
+Function output/parameters: none
+Function output/returned: root of result (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: runSetOperation
+*/
+AvlTreeNodeType *treeDifference( AvlTreeNodeType *onePtr,
+                                      AvlTreeNodeType *twoPtr, int numThreads );
+
+/*
+Name: treeIntersection
+Process: keeps in first tree only rooms also in second tree, with their
+         first tree data, in O(m log(n/m + 1)) for trees of m and n
+         rooms, m <= n, plus releasing dropped rooms
+Function input/parameters: first tree, which is changed (AvlTreeNodeType *),
+                           second tree, read only and not first tree
+                           itself, a copyTree copy is fine
+                           (AvlTreeNodeType *),
+                           threads, 1 for this one only (int)
+Function output/parameters: none
+Function output/returned: root of result (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: runSetOperation
+*/
+AvlTreeNodeType *treeIntersection( AvlTreeNodeType *onePtr,
+                                      AvlTreeNodeType *twoPtr, int numThreads );
+
+/*
+Name: treeUnion
+Process: adds every room of second tree to first tree, rooms in both
+         take second tree's data as upsert would, in O(m log(n/m + 1))
+         for trees of m and n rooms, m <= n, so a small change list
+         merges into a large tree in close to its own size
+Function input/parameters: first tree, which is changed (AvlTreeNodeType *),
+                           second tree, read only and not first tree
+                           itself, a copyTree copy is fine
+                           (AvlTreeNodeType *),
+                           threads, 1 for this one only (int)
+Function output/parameters: none
+Function output/returned: root of result (AvlTreeNodeType *)
+Device input/---: none
+Device output/---: none
+Dependencies: runSetOperation
+*/
+AvlTreeNodeType *treeUnion( AvlTreeNodeType *onePtr,
+                                      AvlTreeNodeType *twoPtr, int numThreads );
+
+#endif   // TREE_SET_UTILITY_H
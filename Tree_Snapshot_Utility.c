@@ -0,0 +1,380 @@
+// header files
+#include "Tree_Snapshot_Utility.h"
+
+unsigned long long alignSnapshotOffset(unsigned long long offset)
+{
+    return ( offset + SNAPSHOT_ALIGNMENT - 1 )
+                          & ~(unsigned long long)( SNAPSHOT_ALIGNMENT - 1 );
+}
+
+bool checkSnapshotHeader(const TreeSnapshotHeaderType* headerPtr,
+                                                                 long fileSize)
+{
+    // initialize variables
+    unsigned long long setupEnd, recordEnd;
+
+    // check header fits and names this layout on this byte order
+    if ( fileSize < (long)sizeof(TreeSnapshotHeaderType)
+          || !isSameString( headerPtr->magic, SNAPSHOT_MAGIC )
+          || headerPtr->byteOrderMark != SNAPSHOT_BYTE_ORDER_MARK
+          || headerPtr->version != SNAPSHOT_VERSION
+          || headerPtr->headerSize != sizeof(TreeSnapshotHeaderType)
+          || headerPtr->recordSize != sizeof(TreeSnapshotRecordType)
+          || headerPtr->numSetups > MAX_CLASS_SETUPS
+          || headerPtr->stringBytes > 0xFFFFFFFFull )
+    {
+        return false;
+    }
+
+    // find where setup and record sections end
+    setupEnd = headerPtr->setupOffset
+        + (unsigned long long)headerPtr->numSetups * SETUP_CAPACITY;
+    recordEnd = headerPtr->recordOffset
+        + (unsigned long long)headerPtr->numRecords * headerPtr->recordSize;
+
+    // return test of sections in order, aligned, and inside file
+    return headerPtr->setupOffset == headerPtr->headerSize
+        && headerPtr->recordOffset == alignSnapshotOffset( setupEnd )
+        && headerPtr->stringOffset == alignSnapshotOffset( recordEnd )
+        && headerPtr->stringOffset + headerPtr->stringBytes
+                                         <= (unsigned long long)fileSize;
+}
+
+bool checkSnapshotNode(AvlTreeNodeType* nodePtr)
+{
+    // initialize variables
+    int balanceFactor = findBalanceFactor( nodePtr );
+
+    // return test of height and balance
+    return nodePtr->height == findMax( findTreeHeight( nodePtr->leftChildPtr ),
+                             findTreeHeight( nodePtr->rightChildPtr ) ) + 1
+        && balanceFactor >= -1 && balanceFactor <= 1;
+}
+
+bool linkSnapshotRecords(NodeArenaType* arenaPtr,
+                         const TreeSnapshotHeaderType* headerPtr,
+                         const unsigned short* setupIds,
+                                                    AvlTreeNodeType** rootPtr)
+{
+    // initialize variables
+    const char *fileDataPtr = (const char *)headerPtr;
+    const TreeSnapshotRecordType *recordPtr = (const TreeSnapshotRecordType *)
+                                   ( fileDataPtr + headerPtr->recordOffset );
+    AvlTreeNodeType *spinePtrs[ MAX_ITERATOR_DEPTH ];
+    AvlTreeNodeType *nodePtr, *poppedPtr, *priorPtr = NULL;
+    unsigned int index;
+    int spineTop = 0;
+
+    *rootPtr = NULL;
+
+    // loop across records in order
+    for ( index = 0; index < headerPtr->numRecords; index++, recordPtr++ )
+    {
+        // check text ends in its section, setup id and height in range
+        if ( recordPtr->classSetupId >= headerPtr->numSetups
+              || (unsigned long long)recordPtr->buildingRoomOffset
+                    + recordPtr->buildingRoomLength >= headerPtr->stringBytes
+              || arenaPtr->stringHeapPtr[ recordPtr->buildingRoomOffset
+                           + recordPtr->buildingRoomLength ] != NULL_CHAR
+              || recordPtr->height >= MAX_ITERATOR_DEPTH - 1 )
+        {
+            return false;
+        }
+
+        // create node, fields are taken as stored
+        nodePtr = allocateArenaNode( arenaPtr );
+        nodePtr->arenaPtr = arenaPtr;
+        nodePtr->roomKey = recordPtr->roomKey;
+        copyStringWithLimit( nodePtr->roomNumber, recordPtr->roomNumber,
+                                                         ROOM_NUM_CAPACITY );
+        nodePtr->roomCapacity = recordPtr->roomCapacity;
+        nodePtr->buildingRoomOffset = recordPtr->buildingRoomOffset;
+        nodePtr->buildingRoomLength = recordPtr->buildingRoomLength;
+        nodePtr->classSetupId = setupIds[ recordPtr->classSetupId ];
+        nodePtr->height = recordPtr->height;
+        nodePtr->leftChildPtr = NULL;
+        nodePtr->rightChildPtr = NULL;
+
+        // check room numbers strictly increase
+        if ( priorPtr != NULL
+              && compareRoomKeys( priorPtr->roomKey, priorPtr->roomNumber,
+                            nodePtr->roomKey, nodePtr->roomNumber ) >= 0 )
+        {
+            return false;
+        }
+
+        priorPtr = nodePtr;
+
+        // shorter spine nodes are complete, last one is left child
+        poppedPtr = NULL;
+
+        while ( spineTop > 0
+                    && spinePtrs[ spineTop - 1 ]->height < nodePtr->height )
+        {
+            spineTop--;
+            poppedPtr = spinePtrs[ spineTop ];
+
+            if ( !checkSnapshotNode( poppedPtr ) )
+            {
+                return false;
+            }
+        }
+
+        // taller spine node above gets this node as right child,
+        // equal height cannot happen in an AVL tree
+        if ( spineTop > 0 )
+        {
+            if ( spinePtrs[ spineTop - 1 ]->height == nodePtr->height )
+            {
+                return false;
+            }
+
+            spinePtrs[ spineTop - 1 ]->rightChildPtr = nodePtr;
+        }
+
+        nodePtr->leftChildPtr = poppedPtr;
+
+        spinePtrs[ spineTop ] = nodePtr;
+        spineTop++;
+    }
+
+    // check remaining spine, lowest first
+    while ( spineTop > 0 )
+    {
+        spineTop--;
+
+        if ( !checkSnapshotNode( spinePtrs[ spineTop ] ) )
+        {
+            return false;
+        }
+
+        // bottom of spine is root
+        *rootPtr = spinePtrs[ spineTop ];
+    }
+
+    return true;
+}
+
+int loadTreeSnapshot(const char* fileName, AvlTreeNodeType** rootPtr)
+{
+    // initialize variables
+    MappedInputFileType mappedFile;
+    const TreeSnapshotHeaderType *headerPtr;
+    const char *textPtr, *setupNamePtr;
+    NodeArenaType *arenaPtr;
+    unsigned short *setupIds;
+    unsigned long long index;
+    int numRecords;
+    bool success;
+
+    *rootPtr = NULL;
+
+    // map file, check header
+    if ( !openMappedInputFile( &mappedFile, fileName ) )
+    {
+        return -1;
+    }
+
+    headerPtr = (const TreeSnapshotHeaderType *)mappedFile.dataPtr;
+
+    if ( !checkSnapshotHeader( headerPtr, mappedFile.fileSize ) )
+    {
+        closeMappedInputFile( &mappedFile );
+        return -1;
+    }
+
+    // find id in this program of each stored setup, id zero is empty
+    setupIds = (unsigned short *)malloc(
+                        ( headerPtr->numSetups + 1 ) * sizeof(unsigned short) );
+    setupIds[ 0 ] = EMPTY_CLASS_SETUP_ID;
+
+    for ( index = 1; index < headerPtr->numSetups; index++ )
+    {
+        setupNamePtr = mappedFile.dataPtr + headerPtr->setupOffset
+                                                     + index * SETUP_CAPACITY;
+
+        // unterminated name is stored as empty setup
+        setupIds[ index ] = setupNamePtr[ SETUP_CAPACITY - 1 ] == NULL_CHAR
+                   ? internClassSetup( setupNamePtr ) : EMPTY_CLASS_SETUP_ID;
+    }
+
+    // text section becomes string heap as is, offsets need no change
+    arenaPtr = createNodeArena();
+
+    if ( headerPtr->stringBytes > 0 )
+    {
+        arenaPtr->stringHeapPtr = (char *)malloc( headerPtr->stringBytes );
+        arenaPtr->heapUsed = (unsigned int)headerPtr->stringBytes;
+        arenaPtr->heapCapacity = arenaPtr->heapUsed;
+        textPtr = mappedFile.dataPtr + headerPtr->stringOffset;
+
+        for ( index = 0; index < headerPtr->stringBytes; index++ )
+        {
+            arenaPtr->stringHeapPtr[ index ] = textPtr[ index ];
+        }
+    }
+
+    // create and link nodes, one slab sized to fit them all
+    arenaPtr->nextSlabCapacity = findMax( (int)headerPtr->numRecords, 1 );
+    success = linkSnapshotRecords( arenaPtr, headerPtr, setupIds, rootPtr );
+    numRecords = (int)headerPtr->numRecords;
+
+    free( setupIds );
+    closeMappedInputFile( &mappedFile );
+
+    // check for rejected records or empty tree
+    if ( !success || isEmpty( *rootPtr ) )
+    {
+        clearNodeArena( arenaPtr );
+        *rootPtr = NULL;
+
+        return success ? 0 : -1;
+    }
+
+    // return number of rooms
+    return numRecords;
+}
+
+int saveTreeSnapshot(const char* fileName, AvlTreeNodeType* rootPtr)
+{
+    // initialize variables
+    ClassSetupDictionaryType *dictionaryPtr = accessClassSetupDictionary();
+    TreeSnapshotHeaderType header = { SNAPSHOT_MAGIC };
+    BufferedOutputWriterType writer;
+    TreeIteratorType iterator;
+    AvlTreeNodeType *nodePtr;
+    unsigned long long setupEnd;
+    char setupName[ SETUP_CAPACITY ];
+    int setupId, index;
+    bool success;
+
+    // find room count and text size
+    header.byteOrderMark = SNAPSHOT_BYTE_ORDER_MARK;
+    header.version = SNAPSHOT_VERSION;
+    header.headerSize = sizeof(TreeSnapshotHeaderType);
+    header.recordSize = sizeof(TreeSnapshotRecordType);
+
+    initializeTreeIterator( &iterator, rootPtr );
+
+    while ( ( nodePtr = getNextTreeNode( &iterator ) ) != NULL )
+    {
+        header.numRecords++;
+        header.stringBytes += nodePtr->buildingRoomLength + 1;
+    }
+
+    // setups added later by other threads are not used by this tree
+    pthread_mutex_lock( &dictionaryPtr->dictionaryLock );
+    header.numSetups = (unsigned int)dictionaryPtr->numSetups;
+    pthread_mutex_unlock( &dictionaryPtr->dictionaryLock );
+
+    // place sections
+    header.setupOffset = header.headerSize;
+    setupEnd = header.setupOffset
+                     + (unsigned long long)header.numSetups * SETUP_CAPACITY;
+    header.recordOffset = alignSnapshotOffset( setupEnd );
+    header.stringOffset = alignSnapshotOffset( header.recordOffset
+              + (unsigned long long)header.numRecords * header.recordSize );
+
+    initializeBufferedWriter( &writer );
+
+    if ( !openBinaryBufferedWriter( &writer, fileName ) )
+    {
+        // file could not be created
+        return -1;
+    }
+
+    // write header, then setup names by id, id zero left empty
+    success = writeBytesToBufferedWriter( &writer, (const char *)&header,
+                                                         header.headerSize )
+           && writeRepeatedCharacterToBufferedWriter( &writer, NULL_CHAR,
+                                                            SETUP_CAPACITY );
+
+    for ( setupId = 1; success && setupId < (int)header.numSetups; setupId++ )
+    {
+        // name is padded with NULL_CHAR, not whatever follows it in page
+        for ( index = 0; index < SETUP_CAPACITY; index++ )
+        {
+            setupName[ index ] = NULL_CHAR;
+        }
+
+        copyStringWithLimit( setupName, 
+                 findClassSetupName( dictionaryPtr, setupId ), SETUP_CAPACITY );
+
+        success = writeBytesToBufferedWriter( &writer, setupName, 
+                                                            SETUP_CAPACITY );
+    }
+
+    // pad to records, write records and text
+    success = success
+           && writeRepeatedCharacterToBufferedWriter( &writer, NULL_CHAR,
+                                 (int)( header.recordOffset - setupEnd ) )
+           && writeSnapshotRecords( &writer, rootPtr );
+
+    // write out what is left, report any failure
+    if ( !closeBufferedWriter( &writer ) || !success )
+    {
+        return -1;
+    }
+
+    return (int)header.numRecords;
+}
+
+bool writeSnapshotRecords(BufferedOutputWriterType* writerPtr,
+                                                     AvlTreeNodeType* rootPtr)
+{
+    // initialize variables
+    TreeSnapshotRecordType record;
+    TreeIteratorType iterator;
+    AvlTreeNodeType *nodePtr;
+    unsigned long long recordBytes = 0;
+    unsigned int textOffset = 0;
+    int index;
+    bool success = true;
+
+    // loop across rooms in order, writing records
+    initializeTreeIterator( &iterator, rootPtr );
+
+    while ( success && ( nodePtr = getNextTreeNode( &iterator ) ) != NULL )
+    {
+        // clear room number and unused bytes, file holds no stale data
+        for ( index = 0; index < ROOM_NUM_CAPACITY; index++ )
+        {
+            record.roomNumber[ index ] = NULL_CHAR;
+        }
+
+        record.reserved[ 0 ] = record.reserved[ 1 ] = 0;
+
+        // copy fields, text offset is where text will be in file section
+        record.roomKey = nodePtr->roomKey;
+        record.roomCapacity = nodePtr->roomCapacity;
+        record.buildingRoomOffset = textOffset;
+        record.classSetupId = nodePtr->classSetupId;
+        copyStringWithLimit( record.roomNumber, nodePtr->roomNumber,
+                                                         ROOM_NUM_CAPACITY );
+        record.buildingRoomLength = nodePtr->buildingRoomLength;
+        record.height = (unsigned char)nodePtr->height;
+
+        success = writeBytesToBufferedWriter( writerPtr,
+                                    (const char *)&record, sizeof(record) );
+
+        textOffset += nodePtr->buildingRoomLength + 1;
+        recordBytes += sizeof(record);
+    }
+
+    // pad to text section
+    success = success && writeRepeatedCharacterToBufferedWriter( writerPtr,
+                NULL_CHAR, (int)( alignSnapshotOffset( recordBytes )
+                                                            - recordBytes ) );
+
+    // loop across rooms in same order, writing text with terminators
+    initializeTreeIterator( &iterator, rootPtr );
+
+    while ( success && ( nodePtr = getNextTreeNode( &iterator ) ) != NULL )
+    {
+        success = writeBytesToBufferedWriter( writerPtr,
+                                  accessBuildingRoom( nodePtr ),
+                                  nodePtr->buildingRoomLength + 1 );
+    }
+
+    return success;
+}
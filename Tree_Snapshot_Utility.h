@@ -0,0 +1,185 @@
+#ifndef TREE_SNAPSHOT_UTILITY_H
+#define TREE_SNAPSHOT_UTILITY_H
+
+// Header files
+#include <stdlib.h>
+#include <stdbool.h>
+#include "File_Input_Utility.h"
+#include "AVL_Tree_Utility.h"
+
+// Constants
+
+// layout version, changed whenever header, record or key layout changes
+typedef enum { SNAPSHOT_VERSION = 1, SNAPSHOT_MAGIC_LENGTH = 8,
+                                  SNAPSHOT_ALIGNMENT = 8 } SnapshotLayout;
+
+// written as one value, read back differently on other byte order
+#define SNAPSHOT_BYTE_ORDER_MARK 0x01020304u
+
+#define SNAPSHOT_MAGIC "AVLSNAP"
+
+// Data Structures
+
+// start of file, sections follow at given offsets, each a multiple
+// of SNAPSHOT_ALIGNMENT: class setup names, records, building/room text
+typedef struct TreeSnapshotHeaderStruct
+   {
+    char magic[ SNAPSHOT_MAGIC_LENGTH ];
+
+    unsigned int byteOrderMark, version;
+
+    unsigned int headerSize, recordSize;
+
+    unsigned int numRecords, numSetups;
+
+    unsigned long long setupOffset, recordOffset;
+
+    unsigned long long stringOffset, stringBytes;
+   } TreeSnapshotHeaderType;
+
+// one room, records are in room number order with node heights,
+// which is enough to relink tree without comparisons or rotations;
+// text offset is into building/room section, setup id indexes
+// setup name section, no pointers are stored
+typedef struct TreeSnapshotRecordStruct
+   {
+    unsigned long long roomKey;
+
+    int roomCapacity;
+
+    unsigned int buildingRoomOffset;
+
+    unsigned short classSetupId;
+
+    char roomNumber[ ROOM_NUM_CAPACITY ];
+
+    unsigned char buildingRoomLength, height;
+
+    unsigned char reserved[ 2 ];
+   } TreeSnapshotRecordType;
+
+// Prototypes
+
+/*
+Name: alignSnapshotOffset
+Process: rounds file offset up to next multiple of SNAPSHOT_ALIGNMENT
+Function input/parameters: offset (unsigned long long)
+Function output/parameters: none
+Function output/returned: aligned offset (unsigned long long)
+Device input/---: none
+Device output/---: none
+Dependencies: none
+*/
+unsigned long long alignSnapshotOffset( unsigned long long offset );
+
+/*
+Name: checkSnapshotHeader
+Process: tests snapshot header for this layout version and byte order,
+         and that every section lies inside the file
+Function input/parameters: header (const TreeSnapshotHeaderType *),
+                           file size in bytes (long)
+Function output/parameters: none
+Function output/returned: Boolean result of test (bool)
+Device input/---: none
+Device output/---: none
+Dependencies: isSameString, alignSnapshotOffset
+*/
+bool checkSnapshotHeader( const TreeSnapshotHeaderType *headerPtr,
+                                                               long fileSize );
+
+/*
+Name: checkSnapshotNode
+Process: tests that stored height of relinked node is one more than
+         its taller subtree and its subtrees differ by at most one
+Function input/parameters: relinked node (AvlTreeNodeType *)
+Function output/parameters: none
+Function output/returned: Boolean result of test (bool)
+Device input/---: none
+Device output/---: none
+Dependencies: findTreeHeight, findMax, findBalanceFactor
+*/
+bool checkSnapshotNode( AvlTreeNodeType *nodePtr );
+
+/*
+Name: linkSnapshotRecords
+Process: creates one node per record in arena and links them in one
+         pass: records are in order and each subtree root is the only
+         tallest node of its subtree, so a stack of the right spine
+         built so far places every node; records out of order, heights
+         that do not form an AVL tree, or text and setup ids outside
+         their sections are rejected
+Function input/parameters: node arena (NodeArenaType *),
+                           snapshot header (const TreeSnapshotHeaderType *),
+                           setup ids of this program by stored id
+                           (const unsigned short *)
+Function output/parameters: tree root (AvlTreeNodeType **)
+Function output/returned: success of operation (bool)
+Device input/---: none
+Device output/---: none
+Dependencies: allocateArenaNode, copyStringWithLimit, compareRoomKeys,
+              checkSnapshotNode
+*/
+bool linkSnapshotRecords( NodeArenaType *arenaPtr,
+                          const TreeSnapshotHeaderType *headerPtr,
+                          const unsigned short *setupIds,
+                                               AvlTreeNodeType **rootPtr );
+
+/*
+Name: loadTreeSnapshot
+Process: maps snapshot file and rebuilds tree from it into new arena,
+         building/room text section becomes arena string heap as is,
+         stored class setups are added to dictionary once each,
+         then nodes are relinked in one linear pass with no parsing,
+         comparisons for placement, or rotations
+Function input/parameters: file name (const char *)
+Function output/parameters: root pointer, NULL on failure
+                            (AvlTreeNodeType **)
+Function output/returned: number of rooms loaded, or -1 if file could not
+                          be read or is not a valid snapshot (int)
+Device input/file: snapshot mapped from HD
+Device output/---: none
+Dependencies: openMappedInputFile, checkSnapshotHeader, malloc, sizeof,
+              internClassSetup, createNodeArena, linkSnapshotRecords,
+              clearNodeArena, free, closeMappedInputFile
+*/
+int loadTreeSnapshot( const char *fileName, AvlTreeNodeType **rootPtr );
+
+/*
+Name: saveTreeSnapshot
+Process: writes tree to snapshot file: header, class setup names,
+         one fixed size record per room in order, then building/room
+         text of each room in same order; file is written in binary
+         mode so no byte is changed on the way
+Function input/parameters: file name (const char *),
+                           tree root (AvlTreeNodeType *)
+Function output/parameters: none
+Function output/returned: number of rooms saved, or -1 if file could not
+                          be written (int)
+Device input/---: none
+Device output/file: snapshot written to HD
+Dependencies: initializeTreeIterator, getNextTreeNode, accessBuildingRoom,
+              accessClassSetupDictionary, pthread_mutex_lock,
+              pthread_mutex_unlock, alignSnapshotOffset,
+              openBinaryBufferedWriter, writeBytesToBufferedWriter,
+              writeRepeatedCharacterToBufferedWriter, findClassSetupName,
+              copyStringWithLimit, writeSnapshotRecords, closeBufferedWriter
+*/
+int saveTreeSnapshot( const char *fileName, AvlTreeNodeType *rootPtr );
+
+/*
+Name: writeSnapshotRecords
+Process: writes one record per room in order, then building/room text
+         of each room in same order, each text followed by NULL_CHAR
+Function input/parameters: open writer (BufferedOutputWriterType *),
+                           tree root (AvlTreeNodeType *)
+Function output/parameters: updated writer (BufferedOutputWriterType *)
+Function output/returned: success of operation (bool)
+Device input/---: none
+Device output/file: records written when writer is flushed
+Dependencies: initializeTreeIterator, getNextTreeNode, copyStringWithLimit,
+              writeBytesToBufferedWriter, accessBuildingRoom
+*/
+bool writeSnapshotRecords( BufferedOutputWriterType *writerPtr,
+                                                  AvlTreeNodeType *rootPtr );
+
+#endif   // TREE_SNAPSHOT_UTILITY_H
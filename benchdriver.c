@@ -0,0 +1,1056 @@
+// header files
+#include <time.h>
+#ifdef _WIN32
+#define PSAPI_VERSION 2
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+#include "AVL_Tree_Utility.h"
+#include "Room_Data_Utility.h"
+#include "Frozen_Tree_Utility.h"
+#include "Tree_Snapshot_Utility.h"
+#include "Concurrent_Tree_Utility.h"
+#include "Sharded_Tree_Utility.h"
+#include "Tree_Set_Utility.h"
+#include "Indexed_Tree_Utility.h"
+#include "Room_Generator_Utility.h"
+#include "Benchmark_Baseline.h"
+
+// constant definitions
+
+const int DEFAULT_BENCH_ROWS = 1000000;
+
+const int FILE_REPEATS = 200;
+
+const int SEARCH_BATCH_SIZE = 512;
+
+const int NUM_COPY_THREADS = 4;
+
+const int CONCURRENT_SEARCH_PASSES = 4;
+
+const int NUM_SHARDS = 16;
+
+const int NUM_SHARD_THREADS = 4;
+
+const int SET_DELTA_STRIDE = 100;
+
+const int NUM_SET_THREADS = 4;
+
+const unsigned long long QUERY_SEED = 2463534242ULL;
+
+const char BENCH_CSV_FILE_NAME[] = "benchmark9.csv";
+
+const char BENCH_SNAPSHOT_FILE_NAME[] = "benchmark9.snap";
+
+#ifdef _WIN32
+const char NULL_DEVICE_NAME[] = "NUL";
+#else
+const char NULL_DEVICE_NAME[] = "/dev/null";
+#endif
+
+// data structures
+
+// writer thread changing concurrent tree while searches are timed
+typedef struct ConcurrentWriterStruct
+   {
+    ConcurrentTreeType *treePtr;
+
+    RoomRecordType *recordArray;
+
+    int numRows, stopFlag;
+
+    long numWrites;
+   } ConcurrentWriterType;
+
+// prototypes
+void benchmarkBaselines( RoomRecordType *recordArray,
+                                       const char **queryNumbers, int numRows );
+void benchmarkBundledFiles();
+void benchmarkConcurrentSearch( RoomRecordType *recordArray,
+                                       const char **queryNumbers, int numRows );
+void benchmarkIndexedTree( RoomRecordType *recordArray,
+                                       const char **queryNumbers, int numRows );
+void benchmarkShardedTree( RoomRecordType *recordArray,
+                                       const char **queryNumbers, int numRows );
+void benchmarkTree( RoomRecordType *recordArray,
+                                       const char **queryNumbers, int numRows );
+void benchmarkTreeSets( RoomRecordType *recordArray, int numRows );
+void countVisit( AvlTreeNodeType *nodePtr, void *contextPtr );
+double findElapsedSeconds( struct timespec startTime );
+long findPeakMemoryKb();
+void reportResult( const char *operation, const char *structure,
+                                                long numOps, double seconds );
+void *runConcurrentWriter( void *writerPtr );
+void startTimer( struct timespec *startTimePtr );
+
+// main function
+int main( int argc, char *argv[] )
+   {
+    RoomRecordType *recordArray;
+    const char **queryNumbers;
+    unsigned long long randomState = QUERY_SEED;
+    const char *swapPtr;
+    int numRows = DEFAULT_BENCH_ROWS, distribution = RANDOM_DISTRIBUTION;
+    int index, swapIndex;
+
+    // find synthetic rows and order, [rows] [distribution] on command line
+    if( argc > 1 )
+       {
+        numRows = atoi( argv[ 1 ] );
+       }
+
+    if( argc > 2 )
+       {
+        distribution = findDistributionByName( argv[ 2 ] );
+       }
+
+    if( numRows < 1 || numRows > MAX_GENERATED_ROWS || distribution < 0 )
+       {
+        printf( "Usage: benchmark9 [rows, 1 to %d] [distribution]\n",
+                                                         MAX_GENERATED_ROWS );
+
+        return 1;
+       }
+
+    // set title
+    printf( "\nAVL BST Benchmark\n" );
+    printf(   "=================\n" );
+    printf( "%-24s %-12s %10s %12s %10s %9s\n", "Operation", "Structure",
+                            "Ops", "ns/op", "Mops/s", "Peak MB" );
+
+    // bundled room files, repeated to get measurable times
+    benchmarkBundledFiles();
+
+    // synthetic rows, queries in random order
+    recordArray = createRoomRecords( numRows, distribution,
+                                                    DEFAULT_GENERATOR_SEED );
+    queryNumbers = (const char **)malloc( numRows * sizeof( const char * ) );
+
+    for( index = 0; index < numRows; index++ )
+       {
+        queryNumbers[ index ] = recordArray[ index ].roomNumber;
+       }
+
+    for( index = numRows - 1; index > 0; index-- )
+       {
+        swapIndex = (int)( findNextRandomValue( &randomState )
+                                                             % ( index + 1 ) );
+        swapPtr = queryNumbers[ index ];
+        queryNumbers[ index ] = queryNumbers[ swapIndex ];
+        queryNumbers[ swapIndex ] = swapPtr;
+       }
+
+    printf( "\nSynthetic rows: %d, %s\n", numRows,
+                                        findDistributionName( distribution ) );
+
+    benchmarkTree( recordArray, queryNumbers, numRows );
+
+    benchmarkConcurrentSearch( recordArray, queryNumbers, numRows );
+
+    benchmarkIndexedTree( recordArray, queryNumbers, numRows );
+
+    benchmarkShardedTree( recordArray, queryNumbers, numRows );
+
+    benchmarkTreeSets( recordArray, numRows );
+
+    benchmarkBaselines( recordArray, queryNumbers, numRows );
+
+    // end program
+    free( queryNumbers );
+    free( recordArray );
+
+    printf( "\nEnd Benchmark\n" );
+
+    return 0;
+   }
+
+/*
+Name: benchmarkBaselines
+Process: times std::map and sorted vector baselines for the same
+         operations as the tree, keys are packed during each timed loop
+         as tree search does
+Function input/parameters: records (RoomRecordType *),
+                           search room numbers (const char **),
+                           number of rows (int)
+Function output/parameters: none
+Function output/returned: none
+Device input/---: none
+Device output/monitor: results displayed
+Dependencies: malloc, createRoomKey, startTimer, findElapsedSeconds,
+              reportResult, createMapBaseline, searchMapBaseline,
+              copyMapBaseline, traverseMapBaseline, clearMapBaseline,
+              createVectorBaseline, searchVectorBaseline, copyVectorBaseline,
+              traverseVectorBaseline, clearVectorBaseline, free
+*/
+void benchmarkBaselines( RoomRecordType *recordArray,
+                                       const char **queryNumbers, int numRows )
+   {
+    struct timespec startTime;
+    unsigned long long *keyArray;
+    const void **valuePtrs;
+    void *mapPtr, *copyPtr;
+    int index, numFound;
+
+    keyArray = (unsigned long long *)malloc(
+                                      numRows * sizeof( unsigned long long ) );
+    valuePtrs = (const void **)malloc( numRows * sizeof( const void * ) );
+
+    // pack keys as input parsing does
+    startTimer( &startTime );
+
+    for( index = 0; index < numRows; index++ )
+       {
+        keyArray[ index ] = createRoomKey( recordArray[ index ].roomNumber );
+        valuePtrs[ index ] = &recordArray[ index ];
+       }
+
+    reportResult( "pack keys", "baseline", numRows,
+                                             findElapsedSeconds( startTime ) );
+
+    // std::map
+    startTimer( &startTime );
+    mapPtr = createMapBaseline( keyArray, valuePtrs, numRows );
+    reportResult( "insert", "std::map", numRows,
+                                             findElapsedSeconds( startTime ) );
+
+    startTimer( &startTime );
+
+    for( index = 0, numFound = 0; index < numRows; index++ )
+       {
+        numFound += searchMapBaseline( mapPtr,
+                          createRoomKey( queryNumbers[ index ] ) ) != NULL;
+       }
+
+    reportResult( "search", "std::map", numFound,
+                                             findElapsedSeconds( startTime ) );
+
+    startTimer( &startTime );
+    copyPtr = copyMapBaseline( mapPtr );
+    reportResult( "copy", "std::map", numRows,
+                                             findElapsedSeconds( startTime ) );
+
+    startTimer( &startTime );
+    numFound = (int)traverseMapBaseline( copyPtr );
+    reportResult( "in order traversal", "std::map", numFound,
+                                             findElapsedSeconds( startTime ) );
+
+    startTimer( &startTime );
+    clearMapBaseline( copyPtr );
+    clearMapBaseline( mapPtr );
+    reportResult( "clear (two maps)", "std::map", 2L * numRows,
+                                             findElapsedSeconds( startTime ) );
+
+    // sorted vector
+    startTimer( &startTime );
+    mapPtr = createVectorBaseline( keyArray, valuePtrs, numRows );
+    reportResult( "build (sort)", "sorted vec", numRows,
+                                             findElapsedSeconds( startTime ) );
+
+    startTimer( &startTime );
+
+    for( index = 0, numFound = 0; index < numRows; index++ )
+       {
+        numFound += searchVectorBaseline( mapPtr,
+                          createRoomKey( queryNumbers[ index ] ) ) != NULL;
+       }
+
+    reportResult( "search", "sorted vec", numFound,
+                                             findElapsedSeconds( startTime ) );
+
+    startTimer( &startTime );
+    copyPtr = copyVectorBaseline( mapPtr );
+    reportResult( "copy", "sorted vec", numRows,
+                                             findElapsedSeconds( startTime ) );
+
+    startTimer( &startTime );
+    numFound = (int)traverseVectorBaseline( copyPtr );
+    reportResult( "in order traversal", "sorted vec", numFound,
+                                             findElapsedSeconds( startTime ) );
+
+    startTimer( &startTime );
+    clearVectorBaseline( copyPtr );
+    clearVectorBaseline( mapPtr );
+    reportResult( "clear (two vectors)", "sorted vec", 2L * numRows,
+                                             findElapsedSeconds( startTime ) );
+
+    free( valuePtrs );
+    free( keyArray );
+   }
+
+/*
+Name: benchmarkBundledFiles
+Process: times loading each bundled room file, bulk built by
+         getDataFromFile and inserted one row at a time,
+         each repeated FILE_REPEATS times
+Function input/parameters: none
+Function output/parameters: none
+Function output/returned: none
+Device input/file: bundled room data files
+Device output/monitor: results displayed
+Dependencies: startTimer, getDataFromFile, clearTree,
+              readRoomRecordsFromFile, insert, findElapsedSeconds,
+              reportResult, free
+*/
+void benchmarkBundledFiles()
+   {
+    const char *fileNames[] = { "RoomData.csv", "RoomData_11B.csv",
+                                "RoomData_11F.csv", "RoomData_50.csv",
+                                "RoomData_50B.csv", "RoomData_50F.csv",
+                                "RoomData_100B.csv", "RoomData_100F.csv" };
+    int numFiles = sizeof( fileNames ) / sizeof( fileNames[ 0 ] );
+    struct timespec startTime;
+    AvlTreeNodeType *rootPtr;
+    RoomRecordType *recordArray;
+    long numLoaded, numInserted;
+    int fileIndex, repeatIndex, recordIndex, numRecords;
+
+    printf( "\nBundled files, each loaded %d times\n", FILE_REPEATS );
+
+    for( fileIndex = 0; fileIndex < numFiles; fileIndex++ )
+       {
+        // file read, parse and bulk build
+        numLoaded = 0;
+        startTimer( &startTime );
+
+        for( repeatIndex = 0; repeatIndex < FILE_REPEATS; repeatIndex++ )
+           {
+            rootPtr = initializeTree();
+            numLoaded += getDataFromFile( fileNames[ fileIndex ], &rootPtr );
+            rootPtr = clearTree( rootPtr );
+           }
+
+        reportResult( fileNames[ fileIndex ], "load", numLoaded,
+                                             findElapsedSeconds( startTime ) );
+
+        // parsed rows inserted one at a time
+        numRecords = readRoomRecordsFromFile( fileNames[ fileIndex ],
+                                                        &recordArray, false );
+        numInserted = 0;
+        startTimer( &startTime );
+
+        for( repeatIndex = 0; repeatIndex < FILE_REPEATS; repeatIndex++ )
+           {
+            rootPtr = initializeTree();
+
+            for( recordIndex = 0; recordIndex < numRecords; recordIndex++ )
+               {
+                rootPtr = insert( rootPtr,
+                                  recordArray[ recordIndex ].roomNumber,
+                                  recordArray[ recordIndex ].buildingRoom,
+                                  recordArray[ recordIndex ].classSetup,
+                                  recordArray[ recordIndex ].roomCapacity );
+               }
+
+            numInserted += numRecords;
+            rootPtr = clearTree( rootPtr );
+           }
+
+        reportResult( fileNames[ fileIndex ], "insert", numInserted,
+                                             findElapsedSeconds( startTime ) );
+
+        free( recordArray );
+       }
+   }
+
+/*
+Name: benchmarkConcurrentSearch
+Process: times searches of concurrent tree with no writer, then with
+         writer thread upserting rooms the whole time, readers never
+         wait for it so search time should change little
+Function input/parameters: records (RoomRecordType *),
+                           search room numbers (const char **),
+                           number of rows (int)
+Function output/parameters: none
+Function output/returned: none
+Device input/---: none
+Device output/monitor: results displayed
+Dependencies: buildTreeFromRecordArray, createConcurrentTree,
+              addConcurrentReader, startTimer, searchConcurrentTree,
+              findElapsedSeconds, reportResult, pthread_create,
+              runConcurrentWriter, pthread_join, removeConcurrentReader,
+              clearConcurrentTree
+*/
+void benchmarkConcurrentSearch( RoomRecordType *recordArray,
+                                       const char **queryNumbers, int numRows )
+   {
+    struct timespec startTime;
+    ConcurrentWriterType writer;
+    RoomRecordType record;
+    pthread_t writerThread;
+    int readerId, pass, index, numFound = 0;
+
+    writer.treePtr = createConcurrentTree(
+                         buildTreeFromRecordArray( recordArray, numRows ) );
+    writer.recordArray = recordArray;
+    writer.numRows = numRows;
+    writer.stopFlag = 0;
+    writer.numWrites = 0;
+
+    readerId = addConcurrentReader( writer.treePtr );
+
+    // readers only
+    startTimer( &startTime );
+
+    for( pass = 0; pass < CONCURRENT_SEARCH_PASSES; pass++ )
+       {
+        for( index = 0; index < numRows; index++ )
+           {
+            numFound += searchConcurrentTree( writer.treePtr, readerId,
+                                             queryNumbers[ index ], &record );
+           }
+       }
+
+    reportResult( "search (no writer)", "concurrent",
+                     (long)numRows * CONCURRENT_SEARCH_PASSES,
+                                             findElapsedSeconds( startTime ) );
+
+    // same searches while writer publishes new versions
+    pthread_create( &writerThread, NULL, runConcurrentWriter, &writer );
+    startTimer( &startTime );
+
+    for( pass = 0; pass < CONCURRENT_SEARCH_PASSES; pass++ )
+       {
+        for( index = 0; index < numRows; index++ )
+           {
+            numFound += searchConcurrentTree( writer.treePtr, readerId,
+                                             queryNumbers[ index ], &record );
+           }
+       }
+
+    reportResult( "search (writer)", "concurrent",
+                     (long)numRows * CONCURRENT_SEARCH_PASSES,
+                                             findElapsedSeconds( startTime ) );
+
+    __atomic_store_n( &writer.stopFlag, 1, __ATOMIC_RELEASE );
+    pthread_join( writerThread, NULL );
+
+    // check for lost rooms, writer only changes capacities
+    if( numFound != 2 * numRows * CONCURRENT_SEARCH_PASSES )
+       {
+        printf( "Concurrent search found %d of %d rooms\n", numFound,
+                                    2 * numRows * CONCURRENT_SEARCH_PASSES );
+       }
+
+    printf( "Writer published %ld versions during searches\n",
+                                                           writer.numWrites );
+
+    removeConcurrentReader( writer.treePtr, readerId );
+    writer.treePtr = clearConcurrentTree( writer.treePtr );
+   }
+
+/*
+Name: benchmarkIndexedTree
+Process: times building hash index over bulk built tree, exact searches
+         by index, upserts of rooms found by index, and inserting one
+         row at a time with index kept in sync
+Function input/parameters: records (RoomRecordType *),
+                           search room numbers (const char **),
+                           number of rows (int)
+Function output/parameters: none
+Function output/returned: none
+Device input/---: none
+Device output/monitor: results displayed
+Dependencies: buildTreeFromRecordArray, countTreeNodes, startTimer,
+              createIndexedTree, findElapsedSeconds, reportResult,
+              searchIndexedTree, upsertIndexedTree, clearIndexedTree,
+              insertIndexedTree
+*/
+void benchmarkIndexedTree( RoomRecordType *recordArray,
+                                       const char **queryNumbers, int numRows )
+   {
+    struct timespec startTime;
+    IndexedTreeType *indexedPtr;
+    AvlTreeNodeType *rootPtr;
+    int index, numRooms, numFound = 0;
+
+    // index over existing tree, rows may repeat rooms
+    rootPtr = buildTreeFromRecordArray( recordArray, numRows );
+    numRooms = countTreeNodes( rootPtr );
+
+    startTimer( &startTime );
+    indexedPtr = createIndexedTree( rootPtr );
+    reportResult( "index build", "indexed", numRooms,
+                                             findElapsedSeconds( startTime ) );
+
+    // exact searches, same random order as tree search
+    startTimer( &startTime );
+
+    for( index = 0; index < numRows; index++ )
+       {
+        numFound += searchIndexedTree( indexedPtr, queryNumbers[ index ] )
+                                                                     != NULL;
+       }
+
+    reportResult( "search", "indexed", numFound,
+                                             findElapsedSeconds( startTime ) );
+
+    // rooms found by index are changed in place
+    startTimer( &startTime );
+
+    for( index = 0; index < numRows; index++ )
+       {
+        upsertIndexedTree( indexedPtr, recordArray[ index ].roomNumber,
+                           recordArray[ index ].buildingRoom,
+                           recordArray[ index ].classSetup,
+                           recordArray[ index ].roomCapacity + 1 );
+       }
+
+    reportResult( "upsert (in place)", "indexed", numRows,
+                                             findElapsedSeconds( startTime ) );
+    indexedPtr = clearIndexedTree( indexedPtr );
+
+    // one row at a time, tree and index
+    indexedPtr = createIndexedTree( NULL );
+    startTimer( &startTime );
+
+    for( index = 0; index < numRows; index++ )
+       {
+        insertIndexedTree( indexedPtr, recordArray[ index ].roomNumber,
+                           recordArray[ index ].buildingRoom,
+                           recordArray[ index ].classSetup,
+                           recordArray[ index ].roomCapacity );
+       }
+
+    reportResult( "insert", "indexed", numRows,
+                                             findElapsedSeconds( startTime ) );
+
+    // check for lost rooms
+    if( numFound != numRows || indexedPtr->numEntries != numRooms )
+       {
+        printf( "Indexed tree found %d of %d, holds %d of %d rooms\n",
+                   numFound, numRows, indexedPtr->numEntries, numRooms );
+       }
+
+    indexedPtr = clearIndexedTree( indexedPtr );
+   }
+
+/*
+Name: benchmarkShardedTree
+Process: times sharded forest, rooms spread by room number hash:
+         inserts one row at a time, then in parallel by shard,
+         searches, and in order iteration merging all shards
+Function input/parameters: records (RoomRecordType *),
+                           search room numbers (const char **),
+                           number of rows (int)
+Function output/parameters: none
+Function output/returned: none
+Device input/---: none
+Device output/monitor: results displayed
+Dependencies: buildTreeFromRecordArray, countTreeNodes, clearTree,
+              createShardedTree, startTimer, insertShardedTree,
+              findElapsedSeconds, reportResult, clearShardedTree,
+              insertShardedRecords, searchShardedTree,
+              initializeShardedIterator, getNextShardedNode,
+              closeShardedIterator
+*/
+void benchmarkShardedTree( RoomRecordType *recordArray,
+                                       const char **queryNumbers, int numRows )
+   {
+    struct timespec startTime;
+    ShardedTreeType *forestPtr;
+    ShardedTreeIteratorType iterator;
+    RoomRecordType record;
+    AvlTreeNodeType *rootPtr;
+    int index, numRooms, numFound = 0, numVisited = 0;
+
+    // count rooms once, rows may repeat rooms
+    rootPtr = buildTreeFromRecordArray( recordArray, numRows );
+    numRooms = countTreeNodes( rootPtr );
+    rootPtr = clearTree( rootPtr );
+
+    // one row at a time, random order
+    forestPtr = createShardedTree( NUM_SHARDS, SHARD_BY_ROOM_HASH );
+    startTimer( &startTime );
+
+    for( index = 0; index < numRows; index++ )
+       {
+        insertShardedTree( forestPtr, recordArray[ index ].roomNumber,
+                           recordArray[ index ].buildingRoom,
+                           recordArray[ index ].classSetup,
+                           recordArray[ index ].roomCapacity );
+       }
+
+    reportResult( "insert", "sharded", numRows,
+                                             findElapsedSeconds( startTime ) );
+    forestPtr = clearShardedTree( forestPtr );
+
+    // whole shards per thread
+    forestPtr = createShardedTree( NUM_SHARDS, SHARD_BY_ROOM_HASH );
+    startTimer( &startTime );
+    insertShardedRecords( forestPtr, recordArray, numRows,
+                                                        NUM_SHARD_THREADS );
+    reportResult( "insert (parallel)", "sharded", numRows,
+                                             findElapsedSeconds( startTime ) );
+
+    // search
+    startTimer( &startTime );
+
+    for( index = 0; index < numRows; index++ )
+       {
+        numFound += searchShardedTree( forestPtr, queryNumbers[ index ],
+                                                                   &record );
+       }
+
+    reportResult( "search", "sharded", numFound,
+                                             findElapsedSeconds( startTime ) );
+
+    // merge of shards in order
+    startTimer( &startTime );
+    initializeShardedIterator( &iterator, forestPtr );
+
+    while( getNextShardedNode( &iterator ) != NULL )
+       {
+        numVisited++;
+       }
+
+    closeShardedIterator( &iterator );
+    reportResult( "in order iteration", "sharded", numVisited,
+                                             findElapsedSeconds( startTime ) );
+
+    // check for lost rooms
+    if( numFound != numRows || numVisited != numRooms )
+       {
+        printf( "Sharded tree found %d of %d, iterated %d of %d rooms\n",
+                               numFound, numRows, numVisited, numRooms );
+       }
+
+    forestPtr = clearShardedTree( forestPtr );
+   }
+
+/*
+Name: benchmarkTree
+Process: times bulk build, insert, search, batched search, frozen search,
+         deep, parallel and shared copy, in order traversal and display output,
+         csv and snapshot save and load, upsert of existing rooms in
+         shared copy, removal, and clear of room tree over given records
+Function input/parameters: records (RoomRecordType *),
+                           search room numbers (const char **),
+                           number of rows (int)
+Function output/parameters: none
+Function output/returned: none
+Device input/---: none
+Device output/monitor: results displayed
+Dependencies: startTimer, buildTreeFromRecordArray, clearTree,
+              initializeTree, insert, search, searchMany, freezeTree,
+              searchFrozenTree, clearFrozenTree, copyTreeDeep,
+              copyTreeParallel, copyTree,
+              visitInOrder,
+              initializeBufferedWriter, openBufferedWriter,
+              writeInOrderRoomNumbers, closeBufferedWriter, writeDataToFile,
+              getDataFromFile, saveTreeSnapshot, loadTreeSnapshot, remove,
+              upsert, removeNode, findElapsedSeconds, reportResult, malloc,
+              free
+*/
+void benchmarkTree( RoomRecordType *recordArray,
+                                       const char **queryNumbers, int numRows )
+   {
+    struct timespec startTime;
+    AvlTreeNodeType *rootPtr, *copyPtr, *loadedPtr;
+    AvlTreeNodeType **foundPtrs;
+    FrozenTreeType *frozenPtr;
+    BufferedOutputWriterType writer;
+    long numVisited;
+    int index, numFound, batchSize;
+
+    // bulk build, sorts then links in linear time
+    startTimer( &startTime );
+    rootPtr = buildTreeFromRecordArray( recordArray, numRows );
+    reportResult( "bulk build", "AVL", numRows,
+                                             findElapsedSeconds( startTime ) );
+
+    startTimer( &startTime );
+    rootPtr = clearTree( rootPtr );
+    reportResult( "clear", "AVL", numRows, findElapsedSeconds( startTime ) );
+
+    // one row at a time, random order
+    startTimer( &startTime );
+    rootPtr = initializeTree();
+
+    for( index = 0; index < numRows; index++ )
+       {
+        rootPtr = insert( rootPtr, recordArray[ index ].roomNumber,
+                          recordArray[ index ].buildingRoom,
+                          recordArray[ index ].classSetup,
+                          recordArray[ index ].roomCapacity );
+       }
+
+    reportResult( "insert", "AVL", numRows, findElapsedSeconds( startTime ) );
+
+    // lookups
+    startTimer( &startTime );
+
+    for( index = 0, numFound = 0; index < numRows; index++ )
+       {
+        numFound += search( rootPtr, queryNumbers[ index ] ) != NULL;
+       }
+
+    reportResult( "search", "AVL", numFound, findElapsedSeconds( startTime ) );
+
+    foundPtrs = (AvlTreeNodeType **)malloc(
+                             SEARCH_BATCH_SIZE * sizeof( AvlTreeNodeType * ) );
+    startTimer( &startTime );
+
+    for( index = 0, numFound = 0; index < numRows; index += SEARCH_BATCH_SIZE )
+       {
+        batchSize = findMin( SEARCH_BATCH_SIZE, numRows - index );
+        numFound += searchMany( rootPtr, queryNumbers + index, batchSize,
+                                                                  foundPtrs );
+       }
+
+    reportResult( "searchMany", "AVL", numFound,
+                                             findElapsedSeconds( startTime ) );
+    free( foundPtrs );
+
+    startTimer( &startTime );
+    frozenPtr = freezeTree( rootPtr );
+    reportResult( "freeze", "frozen", numRows,
+                                             findElapsedSeconds( startTime ) );
+
+    startTimer( &startTime );
+
+    for( index = 0, numFound = 0; index < numRows; index++ )
+       {
+        numFound += searchFrozenTree( frozenPtr, queryNumbers[ index ] )
+                                                                      != NULL;
+       }
+
+    reportResult( "search", "frozen", numFound,
+                                             findElapsedSeconds( startTime ) );
+    frozenPtr = clearFrozenTree( frozenPtr );
+
+    // copy, every node duplicated, then shared
+    startTimer( &startTime );
+    copyPtr = copyTreeDeep( rootPtr );
+    reportResult( "copy (deep)", "AVL", numRows,
+                                             findElapsedSeconds( startTime ) );
+    copyPtr = clearTree( copyPtr );
+
+    startTimer( &startTime );
+    copyPtr = copyTreeParallel( rootPtr, NUM_COPY_THREADS );
+    reportResult( "copy (parallel)", "AVL", numRows,
+                                             findElapsedSeconds( startTime ) );
+    copyPtr = clearTree( copyPtr );
+
+    startTimer( &startTime );
+    copyPtr = copyTree( rootPtr );
+    reportResult( "copy (shared)", "AVL", 1, findElapsedSeconds( startTime ) );
+
+    // traversal, then display output sent to null device
+    startTimer( &startTime );
+    numVisited = visitInOrder( copyPtr, countVisit, NULL );
+    reportResult( "in order traversal", "AVL", numVisited,
+                                             findElapsedSeconds( startTime ) );
+
+    initializeBufferedWriter( &writer );
+
+    if( openBufferedWriter( &writer, NULL_DEVICE_NAME ) )
+       {
+        startTimer( &startTime );
+        numVisited = writeInOrderRoomNumbers( &writer, copyPtr );
+        closeBufferedWriter( &writer );
+        reportResult( "in order display", "AVL", numVisited,
+                                             findElapsedSeconds( startTime ) );
+       }
+
+    // save and reload as csv text, then as binary snapshot
+    startTimer( &startTime );
+    numFound = writeDataToFile( BENCH_CSV_FILE_NAME, copyPtr, COMMA );
+    reportResult( "save", "csv", numFound, findElapsedSeconds( startTime ) );
+
+    startTimer( &startTime );
+    loadedPtr = initializeTree();
+    numFound = getDataFromFile( BENCH_CSV_FILE_NAME, &loadedPtr );
+    reportResult( "load", "csv", numFound, findElapsedSeconds( startTime ) );
+    loadedPtr = clearTree( loadedPtr );
+
+    startTimer( &startTime );
+    numFound = saveTreeSnapshot( BENCH_SNAPSHOT_FILE_NAME, copyPtr );
+    reportResult( "save", "snapshot", numFound,
+                                             findElapsedSeconds( startTime ) );
+
+    startTimer( &startTime );
+    numFound = loadTreeSnapshot( BENCH_SNAPSHOT_FILE_NAME, &loadedPtr );
+    reportResult( "load", "snapshot", numFound,
+                                             findElapsedSeconds( startTime ) );
+    loadedPtr = clearTree( loadedPtr );
+
+    remove( BENCH_CSV_FILE_NAME );
+    remove( BENCH_SNAPSHOT_FILE_NAME );
+
+    // updates copy paths away from original, then every room removed,
+    // on copy
+    startTimer( &startTime );
+
+    for( index = 0; index < numRows; index++ )
+       {
+        copyPtr = upsert( copyPtr, recordArray[ index ].roomNumber,
+                          recordArray[ index ].buildingRoom,
+                          recordArray[ index ].classSetup,
+                          recordArray[ index ].roomCapacity + 1 );
+       }
+
+    reportResult( "upsert (path copy)", "AVL", numRows,
+                                             findElapsedSeconds( startTime ) );
+
+    startTimer( &startTime );
+
+    for( index = 0; index < numRows; index++ )
+       {
+        copyPtr = removeNode( copyPtr, queryNumbers[ index ] );
+       }
+
+    reportResult( "remove", "AVL", numRows, findElapsedSeconds( startTime ) );
+
+    // clear
+    startTimer( &startTime );
+    rootPtr = clearTree( rootPtr );
+    reportResult( "clear", "AVL", numRows, findElapsedSeconds( startTime ) );
+   }
+
+/*
+Name: benchmarkTreeSets
+Process: times merging a change list of every SET_DELTA_STRIDE-th room
+         into full tree by union and by upsert, then union, intersection
+         and difference of full tree with every other room; trees are
+         built before each timing, ops are rooms of second tree
+Function input/parameters: records (RoomRecordType *),
+                           number of rows (int)
+Function output/parameters: none
+Function output/returned: none
+Device input/---: none
+Device output/monitor: results displayed
+Dependencies: malloc, sizeof, buildTreeFromRecordArray, startTimer,
+              treeUnion, findElapsedSeconds, reportResult, clearTree,
+              upsert, treeIntersection, treeDifference, free
+*/
+void benchmarkTreeSets( RoomRecordType *recordArray, int numRows )
+   {
+    struct timespec startTime;
+    AvlTreeNodeType *onePtr, *twoPtr;
+    RoomRecordType *subsetArray;
+    int index, numDelta = 0, numHalf = 0;
+
+    // change list, every SET_DELTA_STRIDE-th room with new capacity,
+    // array is large enough for half of rooms later
+    subsetArray = (RoomRecordType *)malloc(
+                               ( numRows / 2 + 1 ) * sizeof( RoomRecordType ) );
+
+    for( index = 0; index < numRows; index += SET_DELTA_STRIDE )
+       {
+        subsetArray[ numDelta ] = recordArray[ index ];
+        subsetArray[ numDelta ].roomCapacity++;
+        numDelta++;
+       }
+
+    onePtr = buildTreeFromRecordArray( recordArray, numRows );
+    twoPtr = buildTreeFromRecordArray( subsetArray, numDelta );
+
+    startTimer( &startTime );
+    onePtr = treeUnion( onePtr, twoPtr, 1 );
+    reportResult( "union (delta)", "AVL", numDelta,
+                                             findElapsedSeconds( startTime ) );
+    onePtr = clearTree( onePtr );
+
+    onePtr = buildTreeFromRecordArray( recordArray, numRows );
+    startTimer( &startTime );
+
+    for( index = 0; index < numDelta; index++ )
+       {
+        onePtr = upsert( onePtr, subsetArray[ index ].roomNumber,
+                         subsetArray[ index ].buildingRoom,
+                         subsetArray[ index ].classSetup,
+                         subsetArray[ index ].roomCapacity );
+       }
+
+    reportResult( "upsert (delta)", "AVL", numDelta,
+                                             findElapsedSeconds( startTime ) );
+    onePtr = clearTree( onePtr );
+    twoPtr = clearTree( twoPtr );
+
+    // every other room
+    for( index = 0; index < numRows; index += 2 )
+       {
+        subsetArray[ numHalf ] = recordArray[ index ];
+        numHalf++;
+       }
+
+    twoPtr = buildTreeFromRecordArray( subsetArray, numHalf );
+
+    onePtr = buildTreeFromRecordArray( recordArray, numRows );
+    startTimer( &startTime );
+    onePtr = treeUnion( onePtr, twoPtr, 1 );
+    reportResult( "union (half)", "AVL", numHalf,
+                                             findElapsedSeconds( startTime ) );
+    onePtr = clearTree( onePtr );
+
+    onePtr = buildTreeFromRecordArray( recordArray, numRows );
+    startTimer( &startTime );
+    onePtr = treeUnion( onePtr, twoPtr, NUM_SET_THREADS );
+    reportResult( "union (half, parallel)", "AVL", numHalf,
+                                             findElapsedSeconds( startTime ) );
+    onePtr = clearTree( onePtr );
+
+    onePtr = buildTreeFromRecordArray( recordArray, numRows );
+    startTimer( &startTime );
+    onePtr = treeIntersection( onePtr, twoPtr, 1 );
+    reportResult( "intersection (half)", "AVL", numHalf,
+                                             findElapsedSeconds( startTime ) );
+    onePtr = clearTree( onePtr );
+
+    onePtr = buildTreeFromRecordArray( recordArray, numRows );
+    startTimer( &startTime );
+    onePtr = treeDifference( onePtr, twoPtr, 1 );
+    reportResult( "difference (half)", "AVL", numHalf,
+                                             findElapsedSeconds( startTime ) );
+    onePtr = clearTree( onePtr );
+
+    twoPtr = clearTree( twoPtr );
+    free( subsetArray );
+   }
+
+/*
+Name: countVisit
+Process: visit function for traversal timing, counts nothing itself,
+         reads node capacity so visit is not empty
+Function input/parameters: node pointer (AvlTreeNodeType *),
+                           caller data, not used (void *)
+Function output/parameters: none
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: none
+*/
+void countVisit( AvlTreeNodeType *nodePtr, void *contextPtr )
+   {
+    static volatile int capacitySum = 0;
+
+    capacitySum += nodePtr->roomCapacity;
+   }
+
+/*
+Name: findElapsedSeconds
+Process: finds seconds passed since given start time
+Function input/parameters: start time (struct timespec)
+Function output/parameters: none
+Function output/returned: elapsed seconds (double)
+Device input/---: none
+Device output/---: none
+Dependencies: clock_gettime
+*/
+double findElapsedSeconds( struct timespec startTime )
+   {
+    struct timespec endTime;
+
+    clock_gettime( CLOCK_MONOTONIC, &endTime );
+
+    return (double)( endTime.tv_sec - startTime.tv_sec )
+                     + (double)( endTime.tv_nsec - startTime.tv_nsec ) / 1e9;
+   }
+
+/*
+Name: findPeakMemoryKb
+Process: finds largest resident memory of process so far
+Function input/parameters: none
+Function output/parameters: none
+Function output/returned: peak resident memory in kilobytes (long)
+Device input/---: none
+Device output/---: none
+Dependencies: GetProcessMemoryInfo on Windows, getrusage otherwise
+*/
+long findPeakMemoryKb()
+   {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS memoryCounters;
+
+    if( GetProcessMemoryInfo( GetCurrentProcess(), &memoryCounters,
+                                              sizeof( memoryCounters ) ) )
+       {
+        return (long)( memoryCounters.PeakWorkingSetSize / 1024 );
+       }
+
+    return 0;
+#else
+    struct rusage usage;
+
+    getrusage( RUSAGE_SELF, &usage );
+
+    return usage.ru_maxrss;
+#endif
+   }
+
+/*
+Name: reportResult
+Process: displays one result line, time per operation, operations
+         per second and peak resident memory so far
+Function input/parameters: operation and structure names (const char *),
+                           number of operations (long), seconds (double)
+Function output/parameters: none
+Function output/returned: none
+Device input/---: none
+Device output/monitor: result line displayed
+Dependencies: printf, findPeakMemoryKb
+*/
+void reportResult( const char *operation, const char *structure,
+                                                 long numOps, double seconds )
+   {
+    double nsPerOp = 0.0, mopsPerSec = 0.0;
+
+    if( numOps > 0 && seconds > 0.0 )
+       {
+        nsPerOp = seconds * 1e9 / (double)numOps;
+        mopsPerSec = (double)numOps / seconds / 1e6;
+       }
+
+    printf( "%-24s %-12s %10ld %12.1f %10.2f %9.1f\n", operation, structure,
+                   numOps, nsPerOp, mopsPerSec, findPeakMemoryKb() / 1024.0 );
+   }
+
+/*
+Name: runConcurrentWriter
+Process: thread function, upserts rooms in turn with changed capacity
+         into concurrent tree until stop flag is set
+Function input/parameters: writer state (void *)
+Function output/parameters: writer state, number of writes
+                            (ConcurrentWriterType *)
+Function output/returned: NULL (void *)
+Device input/---: none
+Device output/---: none
+Dependencies: upsertConcurrentTree
+*/
+void *runConcurrentWriter( void *writerPtr )
+   {
+    ConcurrentWriterType *wkgWriterPtr = (ConcurrentWriterType *)writerPtr;
+    RoomRecordType *recordPtr;
+    int index = 0;
+
+    while( !__atomic_load_n( &wkgWriterPtr->stopFlag, __ATOMIC_ACQUIRE ) )
+       {
+        recordPtr = &wkgWriterPtr->recordArray[ index ];
+
+        upsertConcurrentTree( wkgWriterPtr->treePtr, recordPtr->roomNumber,
+                              recordPtr->buildingRoom, recordPtr->classSetup,
+                     recordPtr->roomCapacity + (int)wkgWriterPtr->numWrites );
+
+        wkgWriterPtr->numWrites++;
+        index = ( index + 1 ) % wkgWriterPtr->numRows;
+       }
+
+    return NULL;
+   }
+
+/*
+Name: startTimer
+Process: records current time as start of timed section
+Function input/parameters: none
+Function output/parameters: start time (struct timespec *)
+Function output/returned: none
+Device input/---: none
+Device output/---: none
+Dependencies: clock_gettime
+*/
+void startTimer( struct timespec *startTimePtr )
+   {
+    clock_gettime( CLOCK_MONOTONIC, startTimePtr );
+   }
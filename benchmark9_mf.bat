@@ -0,0 +1,2 @@
+g++ -O2 -Wall -c Benchmark_Baseline.cpp -o Benchmark_Baseline.o
+gcc -O2 -Wall benchdriver.c AVL_Tree_Utility.c File_Input_Utility.c File_Output_Utility.c Logging_Utility.c Room_Data_Utility.c Room_Generator_Utility.c Frozen_Tree_Utility.c Tree_Snapshot_Utility.c Concurrent_Tree_Utility.c Sharded_Tree_Utility.c Tree_Set_Utility.c Indexed_Tree_Utility.c Benchmark_Baseline.o -pthread -lstdc++ -o benchmark9
\ No newline at end of file
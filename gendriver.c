@@ -0,0 +1,89 @@
+// header files
+#include "AVL_Tree_Utility.h"
+#include "Room_Data_Utility.h"
+#include "Room_Generator_Utility.h"
+
+// prototypes
+void displayUsage();
+
+// main function
+int main( int argc, char *argv[] )
+   {
+    RoomRecordType *recordArray;
+    unsigned long long seed = DEFAULT_GENERATOR_SEED;
+    int numRows, distribution = FORWARD_DISTRIBUTION, numWritten;
+
+    // generator9 <file name> <rows> [distribution] [seed]
+    if( argc < 3 )
+       {
+        displayUsage();
+
+        return 1;
+       }
+
+    numRows = atoi( argv[ 2 ] );
+
+    if( argc > 3 )
+       {
+        distribution = findDistributionByName( argv[ 3 ] );
+       }
+
+    if( argc > 4 )
+       {
+        seed = strtoull( argv[ 4 ], NULL, 10 );
+       }
+
+    // records are all made before writing, so file order is exact
+    recordArray = createRoomRecords( numRows, distribution, seed );
+
+    if( recordArray == NULL )
+       {
+        displayUsage();
+
+        return 1;
+       }
+
+    numWritten = writeRecordsToFile( argv[ 1 ], recordArray, numRows, COMMA );
+
+    free( recordArray );
+
+    if( numWritten < 0 )
+       {
+        printf( "File %s could not be written\n", argv[ 1 ] );
+
+        return 1;
+       }
+
+    printf( "%d %s rows written to %s, seed %llu\n", numWritten,
+                           findDistributionName( distribution ), argv[ 1 ],
+                                                                       seed );
+
+    return 0;
+   }
+
+/*
+Name: displayUsage
+Process: displays command line form, row limit and distribution names
+Function input/parameters: none
+Function output/parameters: none
+Function output/returned: none
+Device input/---: none
+Device output/monitor: usage displayed
+Dependencies: printf, findDistributionName
+*/
+void displayUsage()
+   {
+    int distribution;
+
+    printf( "Usage: generator9 <file name> <rows> [distribution] [seed]\n" );
+    printf( "   rows: 1 to %d\n", MAX_GENERATED_ROWS );
+    printf( "   distribution:" );
+
+    for( distribution = 0; distribution < NUM_DISTRIBUTIONS; distribution++ )
+       {
+        printf( " %s", findDistributionName( distribution ) );
+       }
+
+    printf( ", default %s\n", findDistributionName( FORWARD_DISTRIBUTION ) );
+    printf( "   seed: not zero, default %llu\n", DEFAULT_GENERATOR_SEED );
+   }
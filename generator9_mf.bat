@@ -0,0 +1 @@
+gcc -O2 -Wall gendriver.c AVL_Tree_Utility.c File_Input_Utility.c File_Output_Utility.c Logging_Utility.c Room_Data_Utility.c Room_Generator_Utility.c -pthread -o generator9
\ No newline at end of file
@@ -1,26 +1,56 @@
 // header files
 #include "File_Input_Utility.h"
 #include "AVL_Tree_Utility.h"
+#include "Room_Data_Utility.h"
+#include "Frozen_Tree_Utility.h"
+#include "Tree_Snapshot_Utility.h"
+#include "Concurrent_Tree_Utility.h"
+#include "Sharded_Tree_Utility.h"
+#include "Tree_Set_Utility.h"
+#include "Indexed_Tree_Utility.h"
 
 // constant definitions
 
-const char DOUBLE_QUOTE = '"';
+const int NUM_LOAD_THREADS = 4;
+
+const int NUM_BUILDING_SHARDS = 8;
 
 // prototypes
 void displayNode( const AvlTreeNodeType dispPtr );
-int getDataFromFile( const char *fileName, AvlTreeNodeType **rootPtr );
+void displayRangeNode( AvlTreeNodeType *nodePtr, void *contextPtr );
 
 // main function
 int main( int argc, char *argv[] )
    {
-    AvlTreeNodeType *rootPtr, *cpdRootPtr;
+    AvlTreeNodeType *rootPtr, *cpdRootPtr, *campusRootPtr, *foundPtr;
+    AvlTreeNodeType *loadedRootPtr, *deltaRootPtr, *setRootPtr;
+    AvlTreeNodeType *batchFoundPtrs[ 4 ];
+    FrozenTreeType *campusSnapshotPtr;
+    ConcurrentTreeType *sharedCampusPtr;
+    ShardedTreeType *buildingForestPtr;
+    ShardedTreeIteratorType shardIterator;
+    IndexedTreeType *indexedCampusPtr;
+    RoomRecordType foundRecord;
+    RoomRecordType *roomRecords;
     char fileName[ STD_STR_LEN ] = "RoomData_50B.csv";
-    int numItems, treeHt;
+    char exportFileName[ STD_STR_LEN ] = "RoomData_Campus.csv";
+    char snapshotFileName[ STD_STR_LEN ] = "RoomData_Campus.snap";
+    const char *campusFileNames[] = { "RoomData_11F.csv", "RoomData_11B.csv",
+                                      "RoomData_50F.csv", "RoomData_100B.csv" };
+    const char *batchRoomNumbers[] = { "018-321", "015-113", 
+                                       "036-316", "999-999" };
+    int numItems, treeHt, readerId, index;
 
     // set title
     printf( "\nAVL BST Test Program\n" );
     printf(   "====================\n" );
 
+    // queue log messages for sink thread, writing to stderr,
+    // setLogLevel( LOG_LEVEL_DEBUG ) also lists records as they load
+       // function: setLogLevel, openLogSink
+    setLogLevel( LOG_LEVEL_INFO );
+    openLogSink( stderr );
+
     // initialize iterator
     rootPtr = initializeTree();
 
@@ -35,6 +65,8 @@ int main( int argc, char *argv[] )
     printf( "\nIn order display of input tree, with height: %d: \n", treeHt );
     inOrderDisplay( rootPtr );
 
+    // copy shares nodes with input tree until either one changes
+       // function: copyTree
     printf( "\n\nCreating duplicate tree\n" );
     cpdRootPtr = copyTree( rootPtr );
 
@@ -42,12 +74,206 @@ int main( int argc, char *argv[] )
     printf( "\nIn order display of copied tree, with height: %d: \n", treeHt );
     inOrderDisplay( cpdRootPtr );
 
+    // load several campus files at once into one tree
+       // function: getDataFromFiles
+    printf( "\n\nLoading campus files in parallel\n" );
+    campusRootPtr = initializeTree();
+    numItems = getDataFromFiles( campusFileNames, 4, NUM_LOAD_THREADS, 
+                                                              &campusRootPtr );
+
+    treeHt = findTreeHeight( campusRootPtr );
+    printf( "Files uploaded, %d items found, merged tree height: %d\n", 
+                                                             numItems, treeHt );
+
+    // freeze campus tree for read only lookups
+       // function: freezeTree, searchFrozenTree
+    campusSnapshotPtr = freezeTree( campusRootPtr );
+    foundPtr = searchFrozenTree( campusSnapshotPtr, "018-321" );
+
+    if( foundPtr != NULL )
+       {
+        printf( "\nFound in frozen campus snapshot:\n" );
+        displayNode( *foundPtr );
+       }
+
+    // look up several room numbers in one pass
+       // function: searchMany
+    numItems = searchMany( campusRootPtr, batchRoomNumbers, 4, 
+                                                              batchFoundPtrs );
+    printf( "\nBatch lookup found %d of 4 room numbers\n", numItems );
+
+    // list one building and find room after a given one
+       // function: rangeQuery, findSuccessor
+    printf( "\nRooms in building 018:\n" );
+    numItems = rangeQuery( campusRootPtr, "018-000", "018-999", 
+                             displayRangeNode, accessDefaultOutputWriter() );
+    flushBufferedWriter( accessDefaultOutputWriter() );
+    printf( "%d rooms listed\n", numItems );
+
+    foundPtr = findSuccessor( campusRootPtr, "018-321" );
+
+    if( foundPtr != NULL )
+       {
+        printf( "\nNext room after 018-321:\n" );
+        displayNode( *foundPtr );
+       }
+
+    // export campus tree in room number order
+       // function: writeDataToFile
+    numItems = writeDataToFile( exportFileName, campusRootPtr, COMMA );
+    printf( "\nExported %d campus rooms to %s\n", numItems, exportFileName );
+
+    // save campus tree as binary snapshot, reload without parsing
+       // function: saveTreeSnapshot, loadTreeSnapshot
+    numItems = saveTreeSnapshot( snapshotFileName, campusRootPtr );
+    printf( "Saved %d campus rooms to %s\n", numItems, snapshotFileName );
+
+    loadedRootPtr = initializeTree();
+    numItems = loadTreeSnapshot( snapshotFileName, &loadedRootPtr );
+    treeHt = findTreeHeight( loadedRootPtr );
+    printf( "Loaded %d rooms from snapshot, tree height: %d\n", 
+                                                             numItems, treeHt );
+
+    // share loaded tree with readers that never wait for changes
+       // function: createConcurrentTree, upsertConcurrentTree,
+       //           searchConcurrentTree, removeConcurrentReader
+    sharedCampusPtr = createConcurrentTree( loadedRootPtr );
+    loadedRootPtr = NULL;
+    readerId = addConcurrentReader( sharedCampusPtr );
+
+    upsertConcurrentTree( sharedCampusPtr, "018-321",
+                          "Liberal Arts Building, Room 321",
+                                                   "Lecture Seating", 48 );
+
+    if( searchConcurrentTree( sharedCampusPtr, readerId, "018-321",
+                                                             &foundRecord ) )
+       {
+        printf( "\nFound in shared campus tree after change:\n" );
+        printf( "%s %s %s %d\n", foundRecord.roomNumber,
+                                  foundRecord.buildingRoom,
+                 foundRecord.classSetup, foundRecord.roomCapacity );
+       }
+
+    removeConcurrentReader( sharedCampusPtr, readerId );
+
+    // spread rooms of one file over shards by building, load shards
+    // in parallel, then show first rooms across all shards in order
+       // function: readRoomRecordsFromFile, insertShardedRecords,
+       //           getNextShardedNode
+    numItems = readRoomRecordsFromFile( "RoomData_100B.csv", &roomRecords,
+                                                                      false );
+
+    if( numItems >= 0 )
+       {
+        buildingForestPtr = createShardedTree( NUM_BUILDING_SHARDS,
+                                                        SHARD_BY_BUILDING );
+        insertShardedRecords( buildingForestPtr, roomRecords, numItems,
+                                                         NUM_LOAD_THREADS );
+        free( roomRecords );
+
+        printf( "\nSharded %d rooms over %d building shards, first rooms:\n",
+                 countShardedTreeNodes( buildingForestPtr ),
+                                                      NUM_BUILDING_SHARDS );
+
+        initializeShardedIterator( &shardIterator, buildingForestPtr );
+
+        for( index = 0; index < 3
+             && ( foundPtr = getNextShardedNode( &shardIterator ) ) != NULL;
+                                                                    index++ )
+           {
+            displayNode( *foundPtr );
+           }
+
+        closeShardedIterator( &shardIterator );
+
+        buildingForestPtr = clearShardedTree( buildingForestPtr );
+       }
+
+    // combine input tree with another file by set operations, each on
+    // a copy of input tree, which keeps its own rooms
+       // function: treeUnion, treeIntersection, treeDifference
+    deltaRootPtr = initializeTree();
+    getDataFromFile( "RoomData_11B.csv", &deltaRootPtr );
+
+    setRootPtr = treeUnion( copyTree( rootPtr ), deltaRootPtr, 1 );
+    printf( "\nWith RoomData_11B.csv: %d rooms in union, ",
+                                                countTreeNodes( setRootPtr ) );
+    setRootPtr = clearTree( setRootPtr );
+
+    setRootPtr = treeIntersection( copyTree( rootPtr ), deltaRootPtr, 1 );
+    printf( "%d in both, ", countTreeNodes( setRootPtr ) );
+    setRootPtr = clearTree( setRootPtr );
+
+    setRootPtr = treeDifference( copyTree( rootPtr ), deltaRootPtr, 1 );
+    printf( "%d only in %s\n", countTreeNodes( setRootPtr ), fileName );
+    setRootPtr = clearTree( setRootPtr );
+
+    deltaRootPtr = clearTree( deltaRootPtr );
+
+    // exact lookups by hash index over copy of campus tree, change
+    // gives index its own nodes so campus tree keeps its data
+       // function: createIndexedTree, upsertIndexedTree, searchIndexedTree
+    indexedCampusPtr = createIndexedTree( copyTree( campusRootPtr ) );
+    upsertIndexedTree( indexedCampusPtr, "036-316",
+                       "Science and Health, Room 316", "Lecture Seating", 36 );
+    foundPtr = searchIndexedTree( indexedCampusPtr, "036-316" );
+
+    if( foundPtr != NULL )
+       {
+        printf( "\nFound by index after change, %d rooms indexed:\n",
+                                               indexedCampusPtr->numEntries );
+        displayNode( *foundPtr );
+       }
+
+    indexedCampusPtr = clearIndexedTree( indexedCampusPtr );
+
+    // change one room and drop another in copied tree, no reload,
+    // input tree keeps its own data
+       // function: upsert, removeNode, search
+    cpdRootPtr = upsert( cpdRootPtr, "018-214", 
+                         "Liberal Arts Building, Room 214", 
+                                                   "Seminar Seating", 20 );
+    cpdRootPtr = removeNode( cpdRootPtr, "018-215" );
+
+    foundPtr = search( cpdRootPtr, "018-214" );
+
+    if( foundPtr != NULL )
+       {
+        printf( "\nUpdated room in copied tree:\n" );
+        displayNode( *foundPtr );
+       }
+
+    foundPtr = search( rootPtr, "018-214" );
+
+    if( foundPtr != NULL )
+       {
+        printf( "Same room in input tree:\n" );
+        displayNode( *foundPtr );
+       }
+
+    printf( "018-215 %s after removal, %d rooms left, %d in input tree\n", 
+            search( cpdRootPtr, "018-215" ) == NULL ? "not found" : "found",
+                      countTreeNodes( cpdRootPtr ), countTreeNodes( rootPtr ) );
+
     // end program
 
+       // clear snapshot before tree it was made from
+          // function: clearFrozenTree
+       campusSnapshotPtr = clearFrozenTree( campusSnapshotPtr );
+
        // clear BST
           // function: clearTree
        rootPtr = clearTree( rootPtr );
        cpdRootPtr = clearTree( cpdRootPtr );
+       campusRootPtr = clearTree( campusRootPtr );
+
+       // clear shared tree, its retired versions with it
+          // function: clearConcurrentTree
+       sharedCampusPtr = clearConcurrentTree( sharedCampusPtr );
+
+       // write remaining log messages, stop sink thread
+          // function: closeLogSink
+       closeLogSink();
 
        // show program end
           // function: printf
@@ -65,102 +291,32 @@ Function output/parameters: none
 Function output/returned: none
 Device input/---: none
 Device output/monitor: node data displayed
-Dependencies: 
+Dependencies: accessDefaultOutputWriter, writeNodeDisplay, 
+              flushBufferedWriter
 */
 void displayNode( const AvlTreeNodeType dispPtr )
    {
-    printf( "Room Number: %s, Building/Room: %s, Class Setup: %s, Room Capacity: %d\n",
-                       dispPtr.roomNumber, dispPtr.buildingRoom, 
-                                      dispPtr.classSetup, dispPtr.roomCapacity );
+    BufferedOutputWriterType *writerPtr = accessDefaultOutputWriter();
+
+    writeNodeDisplay( writerPtr, &dispPtr );
+
+    // show node before any following printf
+    flushBufferedWriter( writerPtr );
    }
 
 /*
-Name: getDataFromFile
-Process: uploads data from file with unknown number of data sets,
-         has internal Verbose Boolean to display input operation
-Function input/parameters: file name (char *)
-Function output/parameters: root pointer (TreeNodeType **)
-Function output/returned: number of values found (int)
-Device input/file: data from HD
-Device output/monitor: none
-Dependencies: malloc, sizeof, openInputFile, readStringToLineEndFromFile,
-              readStringToDelimiterFromFile, checkForEndOfInputFile, 
-              readCharacterFromFile, readIntegerFromFile,
-              insert, printf, closeInputFile, free
+Name: displayRangeNode
+Process: adds node data to writer for each node found by range query,
+         caller flushes writer after query
+Function input/parameters: node pointer (AvlTreeNodeType *),
+                           writer passed as caller data (void *)
+Function output/parameters: none
+Function output/returned: none
+Device input/---: none
+Device output/monitor: node data displayed when writer is flushed
+Dependencies: writeNodeDisplay
 */
-int getDataFromFile( const char *fileName, AvlTreeNodeType **rootPtr )
+void displayRangeNode( AvlTreeNodeType *nodePtr, void *contextPtr )
    {
-    char dummyStr[ MAX_STR_LEN ];
-    char roomNumStr[ ROOM_NUM_CAPACITY ];
-    char bldgRoomStr[ BUILDING_ROOM_CAPACITY ];
-    char clsSetup[ SETUP_CAPACITY ];
-    int roomCap;
-    int index = 0;
-    bool verbose = true;  // Set to true to verify data upload, false otherwise
-
-    if( openInputFile( fileName ) )
-       {
-        if( verbose )
-           {
-            printf( "\n     ----- Verbose: Begin Loading Data From File\n" );
-           }
-
-        // to be ignored - buildingRoom string used as dummy
-        readStringToLineEndFromFile( dummyStr ); 
-
-        readStringToDelimiterFromFile( COMMA, roomNumStr );
-
-        while( !checkForEndOfInputFile() )
-           {
-            // gets rid of first double quote
-            readCharacterFromFile();
-
-            readStringToDelimiterFromFile( DOUBLE_QUOTE, bldgRoomStr );
-
-            // gets rid of comma
-            readCharacterFromFile();
-
-            readStringToDelimiterFromFile( COMMA, clsSetup );
-
-            roomCap = readIntegerFromFile();
-
-            printf( "\n%3d) Inserting %s and balancing\n", 
-                                                        index + 1, roomNumStr );
-
-            *rootPtr = insert( *rootPtr, roomNumStr, 
-                                               bldgRoomStr, clsSetup, roomCap );
-
-            if( verbose )
-               {
-                printf( "Room number: %s | ", roomNumStr );
-
-                printf( "Building/Classroom: %s | ", bldgRoomStr );
-
-                printf( "Classroom setup: %s | ", clsSetup );
-
-                printf( "Room capacity: %d\n", roomCap );
-               }
-
-            // reprime - read next state name
-            readStringToDelimiterFromFile( COMMA, roomNumStr );
-
-            index++;
-           }
-
-        if( verbose )
-           {
-            printf( "\n     ----- Verbose: End Loading Data From File\n\n" );
-           }
-
-        closeInputFile();
-       }
-
-    // file not found
-    else
-       {
-        *rootPtr = NULL;
-       }
-
-    return index;
+    writeNodeDisplay( (BufferedOutputWriterType *)contextPtr, nodePtr );
    }
-
@@ -1 +1 @@
-gcc -Wall maindriver.c AVL_Tree_Utility.c File_Input_Utility.c -o program9
\ No newline at end of file
+gcc -Wall maindriver.c AVL_Tree_Utility.c File_Input_Utility.c File_Output_Utility.c Logging_Utility.c Room_Data_Utility.c Frozen_Tree_Utility.c Tree_Snapshot_Utility.c Concurrent_Tree_Utility.c Sharded_Tree_Utility.c Tree_Set_Utility.c Indexed_Tree_Utility.c -pthread -o program9
\ No newline at end of file